@@ -0,0 +1,178 @@
+"""
+compile_bench.py.
+
+This file is the driver for the compiler throughput benchmark. It
+generates synthetic uC programs of increasing size with gen_uc.py,
+compiles each with ucc.py, and reports the time taken by each phase
+and the peak memory used by Python, so that phases that scale
+superlinearly stand out.
+
+The phases are those that ucc.py records for --time-report, so by
+default the fused check_decls and gen_sections walks are timed as the
+compiler actually runs them. With --no-pipeline, each frontend and
+backend phase is run and timed separately.
+
+Each measurement is made in a fresh interpreter, since the compiler
+keeps global state. Memory is measured in a separate run with
+tracemalloc, which would otherwise distort the timings.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import argparse
+import contextlib
+import json
+import os
+import subprocess
+import sys
+import tracemalloc
+
+import gen_uc
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(BENCH_DIR)
+
+
+def measure(filename, trace_memory, pipeline):
+    """Compile the given file, returning measurements of each phase.
+
+    The phases are run and recorded by ucc.py, as for --time-report,
+    with the fused walks of the pipeline unless pipeline is false. If
+    trace_memory is true, the peak memory allocated by Python during
+    each phase is measured in place of its time.
+    """
+    sys.path.insert(0, REPO_DIR)
+    # pylint: disable=import-outside-toplevel
+    import ucc
+
+    if not pipeline:
+        ucc.disable_pipeline()
+    # records are kept without tracing memory unless it is measured
+    ucc.run_phase.records = []
+    if trace_memory:
+        tracemalloc.start()
+    with open(os.devnull, 'w') as out, contextlib.redirect_stdout(out):
+        try:
+            ucc.uc_compile(filename, False, False, False, None, None)
+        except ucc.CompileError as exc:
+            message = f'{filename}: errors in phase {exc}'
+            raise RuntimeError(message) from exc
+    if trace_memory:
+        return [{'phase': record['phase'], 'peak_kb': record['peak_kb'],
+                 'retained_kb': record['retained_kb']}
+                for record in ucc.run_phase.records]
+    return [{'phase': record['phase'], 'seconds': record['seconds']}
+            for record in ucc.run_phase.records]
+
+
+def measure_in_subprocess(filename, trace_memory, pipeline):
+    """Run measure() on the given file in a fresh interpreter."""
+    command = [sys.executable, os.path.abspath(__file__),
+               '--measure', filename]
+    if trace_memory:
+        command.append('--trace-memory')
+    if not pipeline:
+        command.append('--no-pipeline')
+    result = subprocess.run(command, check=True, stdout=subprocess.PIPE,
+                            text=True)
+    return json.loads(result.stdout)
+
+
+def bench_size(lines, options):
+    """Benchmark compiling a generated program of the given size."""
+    filename = os.path.join(options.build_dir, f'synthetic_{lines}.uc')
+    with open(filename, 'w') as out:
+        units = gen_uc.generate(out, lines, options.expr_depth,
+                                options.array_length, options.seed)
+    with open(filename) as source:
+        actual_lines = sum(1 for _ in source)
+    pipeline = not options.no_pipeline
+    phases = measure_in_subprocess(filename, False, pipeline)
+    if not options.no_memory:
+        memory = measure_in_subprocess(filename, True, pipeline)
+        for phase, usage in zip(phases, memory):
+            phase.update(peak_kb=usage['peak_kb'],
+                         retained_kb=usage['retained_kb'])
+    total = sum(phase['seconds'] for phase in phases)
+    result = {
+        'lines': actual_lines,
+        'units': units,
+        'total_s': total,
+        'lines_per_s': actual_lines / total,
+        'phases': phases,
+    }
+    if not options.no_memory:
+        result['peak_kb'] = max(phase['peak_kb'] for phase in phases)
+    return result
+
+
+def print_table(results):
+    """Print a table of per-phase times to standard out."""
+    names = [phase['phase'] for phase in results[0]['phases']]
+    print(f'{"phase":20}'
+          + ''.join(f'{result["lines"]:>12}' for result in results))
+    for i, name in enumerate(names):
+        print(f'{name:20}'
+              + ''.join(f'{result["phases"][i]["seconds"]:>12.4f}'
+                        for result in results))
+    print(f'{"total":20}'
+          + ''.join(f'{result["total_s"]:>12.4f}' for result in results))
+    print(f'{"lines/s":20}'
+          + ''.join(f'{result["lines_per_s"]:>12.0f}'
+                    for result in results))
+    if 'peak_kb' in results[0]:
+        print(f'{"peak KB":20}'
+              + ''.join(f'{result["peak_kb"]:>12}' for result in results))
+
+
+def main():
+    """Command-line interface."""
+    aparser = argparse.ArgumentParser(description='Benchmark the uC '
+                                      'compiler on synthetic programs.')
+    aparser.add_argument('--lines', type=int, nargs='+',
+                         default=[1000, 10000, 100000],
+                         help='sizes of the programs to compile, in lines')
+    aparser.add_argument('--expr-depth', type=int, default=6,
+                         help='nesting depth of generated expressions')
+    aparser.add_argument('--array-length', type=int, default=64,
+                         help='number of elements in array literals')
+    aparser.add_argument('--seed', type=int, default=0,
+                         help='seed for the program generator')
+    aparser.add_argument('--build-dir',
+                         default=os.path.join(BENCH_DIR, 'build'),
+                         help='directory for generated programs')
+    aparser.add_argument('--out', help='write results as JSON to this '
+                         'file')
+    aparser.add_argument('--no-memory', action='store_true',
+                         help='skip measuring memory')
+    aparser.add_argument('--no-pipeline', action='store_true',
+                         help='run and time each phase separately')
+    aparser.add_argument('--measure', metavar='FILE',
+                         help=argparse.SUPPRESS)
+    aparser.add_argument('--trace-memory', action='store_true',
+                         help=argparse.SUPPRESS)
+    options = aparser.parse_args()
+    if options.measure:
+        # run by measure_in_subprocess()
+        json.dump(measure(options.measure, options.trace_memory,
+                          not options.no_pipeline), sys.stdout)
+        return
+    os.makedirs(options.build_dir, exist_ok=True)
+
+    results = []
+    for lines in options.lines:
+        print(f'Compiling {lines} lines...', file=sys.stderr)
+        results.append(bench_size(lines, options))
+    print_table(results)
+    if options.out:
+        with open(options.out, 'w') as out:
+            json.dump({'pipeline': not options.no_pipeline,
+                       'expr_depth': options.expr_depth,
+                       'array_length': options.array_length,
+                       'seed': options.seed, 'sizes': results},
+                      out, indent=2)
+            out.write('\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,81 @@
+/**
+ * Benchmark: a storm of pushes and pops on both ends of a deque
+ * implemented as a doubly linked list. The number of operations is
+ * given by the first argument.
+ */
+
+struct node(int value, node prev, node next);
+
+struct deque(node front, node back, int size);
+
+void main(string[] args)(int n, int seed, int i, deque d, int total) {
+  n = 1000000;
+  if (args.length > 0) {
+    n = string_to_int(args[0]);
+  }
+  d = new deque(null, null, 0);
+  seed = 99;
+  total = 0;
+  for (i = 0; i < n; ++i) {
+    seed = (seed * 1103 + 12345) % 1000003;
+    if (seed % 5 < 2) {
+      push_front(d, i);
+    } else if (seed % 5 < 4) {
+      push_back(d, i);
+    } else if (d.size > 0 && seed % 2 == 0) {
+      total = (total + pop_front(d)) % 1000003;
+    } else if (d.size > 0) {
+      total = (total + pop_back(d)) % 1000003;
+    }
+  }
+  while (d.size > 0) {
+    total = (total + pop_front(d)) % 1000003;
+  }
+  println("total: " + total);
+}
+
+void push_front(deque d, int value)(node n) {
+  n = new node(value, null, d.front);
+  if (d.front == null) {
+    d.back = n;
+  } else {
+    d.front.prev = n;
+  }
+  d.front = n;
+  d.size = d.size + 1;
+}
+
+void push_back(deque d, int value)(node n) {
+  n = new node(value, d.back, null);
+  if (d.back == null) {
+    d.front = n;
+  } else {
+    d.back.next = n;
+  }
+  d.back = n;
+  d.size = d.size + 1;
+}
+
+int pop_front(deque d)(node n) {
+  n = d.front;
+  d.front = n.next;
+  if (d.front == null) {
+    d.back = null;
+  } else {
+    d.front.prev = null;
+  }
+  d.size = d.size - 1;
+  return n.value;
+}
+
+int pop_back(deque d)(node n) {
+  n = d.back;
+  d.back = n.prev;
+  if (d.back == null) {
+    d.front = null;
+  } else {
+    d.back.next = null;
+  }
+  d.size = d.size - 1;
+  return n.value;
+}
@@ -0,0 +1,184 @@
+"""
+gen_uc.py.
+
+This file generates synthetic uC programs of a given size, for
+measuring the throughput of the compiler. A program consists of
+units, each with a struct and two functions that use it. Each
+function contains deeply nested expressions, a long array literal,
+and calls into the previous unit, so that every phase of the compiler
+has work to do.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import argparse
+import random
+import sys
+import textwrap
+
+# width at which generated lines are wrapped
+LINE_WIDTH = 76
+
+# operators used in generated expressions; division and modulo are
+# left out so that the generated program cannot divide by zero
+INT_OPERATORS = ('+', '-', '*')
+FLOAT_OPERATORS = ('+', '-', '*')
+
+
+class Generator:
+    """Writer of a synthetic uC program."""
+
+    def __init__(self, out, expr_depth, array_length, seed):
+        """Initialize this generator to write to the given file."""
+        self.out = out
+        self.expr_depth = expr_depth
+        self.array_length = array_length
+        self.random = random.Random(seed)
+        self.lines = 0
+
+    def write(self, line=''):
+        """Write a line of code."""
+        print(line, file=self.out)
+        self.lines += 1
+
+    def write_wrapped(self, first, text, indent):
+        """Write text, wrapping it at the line width.
+
+        The first line starts with first, and subsequent lines are
+        indented by the given number of spaces.
+        """
+        for line in textwrap.wrap(text, LINE_WIDTH, initial_indent=first,
+                                  subsequent_indent=' ' * indent,
+                                  break_long_words=False):
+            self.write(line)
+
+    def int_expr(self, depth, unit):
+        """Return an int expression nested to the given depth.
+
+        The expression may refer to the parameters and locals of the
+        unit's combine function.
+        """
+        if depth == 0:
+            choice = self.random.randrange(8)
+            if choice == 0:
+                return str(self.random.randrange(1, 1000))
+            if choice == 1:
+                return 'r.id'
+            if choice == 2:
+                index = self.random.randrange(self.array_length)
+                return f'r.data[{index}]'
+            if choice == 3:
+                return 'r.data.length'
+            if choice == 4 and unit > 0:
+                return f'combine{unit - 1}(y, x, r.link)'
+            return self.random.choice(('x', 'y', 'k', 't'))
+        operator = self.random.choice(INT_OPERATORS)
+        return (f'({self.int_expr(depth - 1, unit)} {operator} '
+                f'{self.int_expr(depth - 1, unit)})')
+
+    def float_expr(self, depth):
+        """Return a float expression nested to the given depth.
+
+        The expression may refer to the locals of a build function.
+        """
+        if depth == 0:
+            if self.random.randrange(2):
+                return f'{self.random.randrange(1, 100) / 8}'
+            return 'w'
+        operator = self.random.choice(FLOAT_OPERATORS)
+        return (f'({self.float_expr(depth - 1)} {operator} '
+                f'{self.float_expr(depth - 1)})')
+
+    def write_unit(self, unit):
+        """Write the struct and functions of the given unit."""
+        link = f'rec{unit - 1}' if unit > 0 else 'rec0'
+        self.write(f'struct rec{unit}(int id, float weight, int[] data, '
+                   f'{link} link);')
+        self.write()
+
+        self.write(f'int combine{unit}(int x, int y, rec{unit} r)'
+                   '(int k, int t) {')
+        self.write_wrapped('  k = ', self.int_expr(self.expr_depth, unit)
+                           + ';', 6)
+        self.write_wrapped('  t = ', self.int_expr(self.expr_depth, unit)
+                           + ';', 6)
+        self.write('  if (k > t) {')
+        self.write('    k = k - t;')
+        self.write('  } else {')
+        self.write('    t = t - k;')
+        self.write('  }')
+        self.write('  while (t > 0 && k < 1000) {')
+        self.write('    k = k + r.data[t % r.data.length];')
+        self.write('    t = t / 2;')
+        self.write('  }')
+        self.write('  return k + t + r.id;')
+        self.write('}')
+        self.write()
+
+        self.write(f'rec{unit} build{unit}(int seed)'
+                   f'(int[] values, float w, rec{unit} r) {{')
+        values = ', '.join(str(self.random.randrange(-1000, 1000))
+                           for _ in range(self.array_length))
+        self.write_wrapped('  values = new int{', values + '};', 18)
+        self.write_wrapped('  w = ', self.float_expr(self.expr_depth)
+                           + ';', 6)
+        self.write(f'  r = new rec{unit}(seed, w, values, null);')
+        if unit > 0:
+            self.write('  if (seed > 0) {')
+            self.write(f'    r.link = build{unit - 1}(seed - 1);')
+            self.write('  }')
+        self.write('  return r;')
+        self.write('}')
+        self.write()
+
+    def generate(self, lines):
+        """Write a program of at least the given number of lines."""
+        unit = 0
+        while self.lines < lines or unit == 0:
+            self.write_unit(unit)
+            unit += 1
+        self.write('void main(string[] args)() {')
+        self.write('  println("" + combine0(1, 2, build0(3)));')
+        self.write('}')
+        return unit
+
+
+def generate(out, lines, expr_depth=6, array_length=64, seed=0):
+    """Write a synthetic uC program to the given file.
+
+    The program has at least the given number of lines. Expressions
+    are nested to expr_depth, array literals have array_length
+    elements, and seed determines the program's contents. Returns the
+    number of units in the program.
+    """
+    return Generator(out, expr_depth, array_length, seed).generate(lines)
+
+
+def main():
+    """Command-line interface."""
+    aparser = argparse.ArgumentParser(description='Generate a synthetic '
+                                      'uC program.')
+    aparser.add_argument('-o', '--output',
+                         help='output file (default: standard out)')
+    aparser.add_argument('--lines', type=int, default=10000,
+                         help='minimum number of lines to generate')
+    aparser.add_argument('--expr-depth', type=int, default=6,
+                         help='nesting depth of generated expressions')
+    aparser.add_argument('--array-length', type=int, default=64,
+                         help='number of elements in array literals')
+    aparser.add_argument('--seed', type=int, default=0,
+                         help='seed for the random number generator')
+    args = aparser.parse_args()
+    if args.array_length < 1:
+        aparser.error('--array-length must be positive')
+    if args.output:
+        with open(args.output, 'w') as out:
+            generate(out, args.lines, args.expr_depth, args.array_length,
+                     args.seed)
+    else:
+        generate(sys.stdout, args.lines, args.expr_depth,
+                 args.array_length, args.seed)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,60 @@
+/**
+ * Benchmark: Conway's game of life on a large toroidal grid. The
+ * side length of the grid is given by the first argument.
+ */
+
+void main(string[] args)(int n, int generations, int seed, int i, int j,
+                         int[,] grid, int[,] next, int[,] tmp,
+                         int alive) {
+  n = 512;
+  if (args.length > 0) {
+    n = string_to_int(args[0]);
+  }
+  generations = 40;
+  grid = new int[n, n];
+  next = new int[n, n];
+  seed = 777;
+  for (i = 0; i < n; ++i) {
+    for (j = 0; j < n; ++j) {
+      seed = (seed * 1103 + 12345) % 1000003;
+      if (seed % 3 == 0) {
+        grid[i, j] = 1;
+      }
+    }
+  }
+  for (i = 0; i < generations; ++i) {
+    step(grid, next);
+    tmp = grid;
+    grid = next;
+    next = tmp;
+  }
+  alive = 0;
+  for (i = 0; i < n; ++i) {
+    for (j = 0; j < n; ++j) {
+      alive = alive + grid[i, j];
+    }
+  }
+  println("alive: " + alive);
+}
+
+void step(int[,] grid, int[,] next)(int n, int i, int j, int up,
+                                    int down, int left, int right,
+                                    int count) {
+  n = grid.rows;
+  for (i = 0; i < n; ++i) {
+    up = (i + n - 1) % n;
+    down = (i + 1) % n;
+    for (j = 0; j < n; ++j) {
+      left = (j + n - 1) % n;
+      right = (j + 1) % n;
+      count = grid[up, left] + grid[up, j] + grid[up, right] +
+              grid[i, left] + grid[i, right] +
+              grid[down, left] + grid[down, j] + grid[down, right];
+      if (count == 3 || (count == 2 && grid[i, j] == 1)) {
+        next[i, j] = 1;
+      } else {
+        next[i, j] = 0;
+      }
+    }
+  }
+}
@@ -0,0 +1,68 @@
+/**
+ * Benchmark: top-down merge sort of pseudo-random integers, with the
+ * halves copied into new arrays at each level. The number of integers
+ * is given by the first argument.
+ */
+
+void main(string[] args)(int n, int seed, int i, int[] nums,
+                         int checksum) {
+  n = 1000000;
+  if (args.length > 0) {
+    n = string_to_int(args[0]);
+  }
+  nums = new int[n];
+  seed = 4242;
+  for (i = 0; i < n; ++i) {
+    seed = (seed * 1103 + 12345) % 1000003;
+    nums[i] = seed;
+  }
+  nums = merge_sort(nums);
+  checksum = 0;
+  for (i = 1; i < n; ++i) {
+    if (nums[i - 1] > nums[i]) {
+      println("not sorted at " + i);
+    }
+    checksum = (checksum * 31 + nums[i]) % 1000003;
+  }
+  println("checksum: " + checksum);
+}
+
+int[] merge_sort(int[] nums)(int mid, int i, int[] left, int[] right) {
+  if (nums.length < 2) {
+    return nums;
+  }
+  mid = nums.length / 2;
+  left = new int[mid];
+  right = new int[nums.length - mid];
+  for (i = 0; i < mid; ++i) {
+    left[i] = nums[i];
+  }
+  for (i = mid; i < nums.length; ++i) {
+    right[i - mid] = nums[i];
+  }
+  return merge(merge_sort(left), merge_sort(right));
+}
+
+int[] merge(int[] left, int[] right)(int[] result, int i, int j) {
+  result = new int{};
+  i = 0;
+  j = 0;
+  while (i < left.length && j < right.length) {
+    if (left[i] <= right[j]) {
+      result << left[i];
+      ++i;
+    } else {
+      result << right[j];
+      ++j;
+    }
+  }
+  while (i < left.length) {
+    result << left[i];
+    ++i;
+  }
+  while (j < right.length) {
+    result << right[j];
+    ++j;
+  }
+  return result;
+}
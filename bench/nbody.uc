@@ -0,0 +1,63 @@
+/**
+ * Benchmark: n-body simulation of particles under a softened
+ * inverse-square attraction. The number of bodies is given by the
+ * first argument.
+ */
+
+struct body(float x, float y, float vx, float vy, float mass);
+
+void main(string[] args)(int n, int steps, int seed, int i,
+                         body[] bodies, float energy) {
+  n = 2000;
+  if (args.length > 0) {
+    n = string_to_int(args[0]);
+  }
+  steps = 5;
+  bodies = new body[n];
+  seed = 12345;
+  for (i = 0; i < n; ++i) {
+    seed = next_random(seed);
+    bodies[i] = new body(seed % 10000 * 0.0001, 0.0, 0.0, 0.0,
+                         1.0 + seed % 7);
+    seed = next_random(seed);
+    bodies[i].y = seed % 10000 * 0.0001;
+  }
+  for (i = 0; i < steps; ++i) {
+    step(bodies, 0.001);
+  }
+  energy = 0.0;
+  for (i = 0; i < n; ++i) {
+    energy = energy + 0.5 * bodies[i].mass *
+      (bodies[i].vx * bodies[i].vx + bodies[i].vy * bodies[i].vy);
+  }
+  println("kinetic energy: " + energy);
+}
+
+int next_random(int seed)() {
+  return (seed * 1103 + 12345) % 1000003;
+}
+
+void step(body[] bodies, float dt)(int i, int j, float ax, float ay,
+                                   float dx, float dy, float r2,
+                                   float inv) {
+  for (i = 0; i < bodies.length; ++i) {
+    ax = 0.0;
+    ay = 0.0;
+    for (j = 0; j < bodies.length; ++j) {
+      if (i != j) {
+        dx = bodies[j].x - bodies[i].x;
+        dy = bodies[j].y - bodies[i].y;
+        r2 = dx * dx + dy * dy + 0.0001;
+        inv = bodies[j].mass / (r2 * sqrt(r2));
+        ax = ax + dx * inv;
+        ay = ay + dy * inv;
+      }
+    }
+    bodies[i].vx = bodies[i].vx + ax * dt;
+    bodies[i].vy = bodies[i].vy + ay * dt;
+  }
+  for (i = 0; i < bodies.length; ++i) {
+    bodies[i].x = bodies[i].x + bodies[i].vx * dt;
+    bodies[i].y = bodies[i].y + bodies[i].vy * dt;
+  }
+}
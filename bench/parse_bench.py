@@ -0,0 +1,147 @@
+"""
+parse_bench.py.
+
+This file is the driver for the parser throughput benchmark. It
+parses the test programs, the benchmark workloads, and synthetic uC
+programs of increasing size from gen_uc.py, both with the fast path in
+ucfastparse.py and with the PLY parser alone. It checks that the two
+produce the same AST, including node ids and source positions, and
+reports the time taken by each and the speedup of the fast path.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import argparse
+import glob
+import io
+import itertools
+import json
+import os
+import sys
+import time
+
+import gen_uc
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(BENCH_DIR)
+
+sys.path.insert(0, REPO_DIR)
+# pylint: disable=wrong-import-position
+import ucbase  # noqa: E402
+import ucfastparse  # noqa: E402
+import ucparser  # noqa: E402
+
+
+def parse_fast(text):
+    """Parse text with the fast path, returning the AST or None."""
+    return ucfastparse.parse(text)
+
+
+def parse_ply(text):
+    """Parse text with the PLY parser alone, returning the AST.
+
+    Returns None if there are syntax errors.
+    """
+    ucparser.num_errors = 0
+    ucparser.has_parallel_for = False
+    ucparser.lexer.lineno = 1
+    tree = ucparser.parser.parse(text, lexer=ucparser.lexer, tracking=True)
+    return None if ucparser.error_count() else tree
+
+
+def timed_parse(parse, text, repeat):
+    """Parse text repeatedly with a fresh node id counter.
+
+    Returns the AST, the next unused node id, and the best time.
+    """
+    best = None
+    for _ in range(repeat):
+        ucbase.ASTNode.next_id = itertools.count()
+        start = time.perf_counter()
+        tree = parse(text)
+        seconds = time.perf_counter() - start
+        best = seconds if best is None else min(best, seconds)
+    return tree, next(ucbase.ASTNode.next_id), best
+
+
+def bench_text(name, text, repeat):
+    """Benchmark parsing the given source, returning the results.
+
+    Exits with an error if the fast path rejects the source or
+    produces a different AST than the PLY parser.
+    """
+    ply_tree, ply_next, ply_s = timed_parse(parse_ply, text, repeat)
+    if ply_tree is None:
+        sys.exit(f'{name}: syntax errors')
+    fast_tree, fast_next, fast_s = timed_parse(parse_fast, text, repeat)
+    if fast_tree is None:
+        sys.exit(f'{name}: rejected by the fast path')
+    if fast_next != ply_next or repr(fast_tree) != repr(ply_tree):
+        sys.exit(f'{name}: the fast path produced a different AST')
+    return {
+        'name': name,
+        'lines': text.count('\n'),
+        'nodes': ply_next,
+        'ply_s': ply_s,
+        'fast_s': fast_s,
+        'speedup': ply_s / fast_s,
+    }
+
+
+def print_table(results):
+    """Print a table of parse times to standard out."""
+    print(f'{"source":28}{"lines":>9}{"nodes":>10}{"PLY s":>10}'
+          f'{"fast s":>10}{"speedup":>9}')
+    for result in results:
+        print(f'{result["name"]:28}{result["lines"]:>9}'
+              f'{result["nodes"]:>10}{result["ply_s"]:>10.4f}'
+              f'{result["fast_s"]:>10.4f}{result["speedup"]:>8.1f}x')
+
+
+def main():
+    """Command-line interface."""
+    aparser = argparse.ArgumentParser(description='Benchmark the uC '
+                                      'parser and check that the fast '
+                                      'path agrees with PLY.')
+    aparser.add_argument('--lines', type=int, nargs='+',
+                         default=[1000, 10000, 100000],
+                         help='sizes of the synthetic programs, in lines')
+    aparser.add_argument('--expr-depth', type=int, default=6,
+                         help='nesting depth of generated expressions')
+    aparser.add_argument('--array-length', type=int, default=64,
+                         help='number of elements in array literals')
+    aparser.add_argument('--seed', type=int, default=0,
+                         help='seed for the program generator')
+    aparser.add_argument('--repeat', type=int, default=3,
+                         help='number of times to parse each program, '
+                         'reporting the best time')
+    aparser.add_argument('--out', help='write results as JSON to this '
+                         'file')
+    options = aparser.parse_args()
+
+    results = []
+    for filename in sorted(glob.glob(os.path.join(REPO_DIR, 'tests',
+                                                  '*.uc'))
+                           + glob.glob(os.path.join(BENCH_DIR, '*.uc'))):
+        with open(filename) as source:
+            results.append(bench_text(os.path.relpath(filename, REPO_DIR),
+                                      source.read(), options.repeat))
+    for lines in options.lines:
+        print(f'Parsing {lines} lines...', file=sys.stderr)
+        out = io.StringIO()
+        gen_uc.generate(out, lines, options.expr_depth,
+                        options.array_length, options.seed)
+        results.append(bench_text(f'synthetic_{lines}', out.getvalue(),
+                                  options.repeat))
+    print_table(results)
+    if options.out:
+        with open(options.out, 'w') as out:
+            json.dump({'expr_depth': options.expr_depth,
+                       'array_length': options.array_length,
+                       'seed': options.seed, 'sources': results},
+                      out, indent=2)
+            out.write('\n')
+
+
+if __name__ == '__main__':
+    main()
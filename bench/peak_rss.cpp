@@ -0,0 +1,56 @@
+/**
+ * peak_rss.cpp
+ *
+ * This file is a wrapper that runs a program and records its peak
+ * resident set size, for the runtime benchmark suite:
+ *
+ *   peak_rss REPORT PROGRAM [ARGS...]
+ *
+ * The peak, in kilobytes, is written to the file REPORT, and the
+ * wrapper exits with the status of the program. A process forked
+ * from the benchmark driver would carry the peak of the Python
+ * interpreter into the ru_maxrss of the program it runs, so the
+ * program is instead forked from this small process.
+ *
+ * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+ */
+
+#include <cstdio>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "usage: %s REPORT PROGRAM [ARGS...]\n", argv[0]);
+    return 2;
+  }
+  pid_t pid = fork();
+  if (pid < 0) {
+    std::perror("fork");
+    return 2;
+  }
+  if (pid == 0) {
+    execv(argv[2], argv + 2);
+    std::perror(argv[2]);
+    _exit(127);
+  }
+  int status;
+  struct rusage usage;
+  if (wait4(pid, &status, 0, &usage) < 0) {
+    std::perror("wait4");
+    return 2;
+  }
+  std::FILE *report = std::fopen(argv[1], "w");
+  if (!report) {
+    std::perror(argv[1]);
+    return 2;
+  }
+  // ru_maxrss is in kilobytes on Linux
+  std::fprintf(report, "%ld\n", usage.ru_maxrss);
+  std::fclose(report);
+  if (WIFSIGNALED(status)) {
+    return 128 + WTERMSIG(status);
+  }
+  return WEXITSTATUS(status);
+}
@@ -0,0 +1,191 @@
+"""
+run_bench.py.
+
+This file is the driver for the runtime benchmark suite. It compiles
+each uC workload in this directory with ucc.py and the C++ compiler,
+runs it several times, and reports the median wall time, the peak
+resident set size, and the allocations made by the program, as
+measured by a separate build with allocation profiling.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import argparse
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(BENCH_DIR)
+
+# workloads, mapped to the arguments they are run with
+WORKLOADS = {
+    'nbody': ['2000'],
+    'life': ['512'],
+    'merge_sort': ['1000000'],
+    'strings': ['60000'],
+    'deque': ['3000000'],
+    'tree_equality': ['20'],
+}
+
+
+def compile_workload(name, build_dir, options, profile=None):
+    """Compile the named workload, returning the path to the program.
+
+    If profile is given, the program is instrumented for the given
+    kinds of profiling.
+    """
+    suffix = '_profile' if profile else ''
+    source = os.path.join(build_dir, name + suffix + '.uc')
+    shutil.copyfile(os.path.join(BENCH_DIR, name + '.uc'), source)
+    command = [sys.executable, os.path.join(REPO_DIR, 'ucc.py'), source,
+               '-C']
+    if profile:
+        command.append('--profile=' + profile)
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    program = os.path.join(build_dir, name + suffix + '.exe')
+    subprocess.run([options.cxx] + options.cxxflags.split()
+                   + ['-I' + options.lib_dir, '-o', program,
+                      source[:-3] + '.cpp'], check=True)
+    return program
+
+
+def compile_wrapper(build_dir, options):
+    """Compile the peak_rss wrapper, returning the path to it."""
+    wrapper = os.path.join(build_dir, 'peak_rss')
+    subprocess.run([options.cxx, '-O2', '-o', wrapper,
+                    os.path.join(BENCH_DIR, 'peak_rss.cpp')], check=True)
+    return wrapper
+
+
+def run_once(program, args, wrapper=None):
+    """Run a program once, returning its output and wall time.
+
+    If the peak_rss wrapper is given, the program is run through it,
+    and its peak resident set size in kilobytes is also returned.
+    Raises an exception if the program fails.
+    """
+    command = [program] + args
+    report = program + '.rss'
+    if wrapper:
+        command = [wrapper, report] + command
+    start = time.perf_counter()
+    result = subprocess.run(command, stdout=subprocess.PIPE,
+                            stderr=subprocess.DEVNULL,
+                            cwd=os.path.dirname(program), check=True)
+    elapsed = time.perf_counter() - start
+    if not wrapper:
+        return result.stdout, elapsed, None
+    with open(report) as peak:
+        return result.stdout, elapsed, int(peak.read())
+
+
+def count_allocations(program, args):
+    """Run an allocation-profiled program, returning its totals.
+
+    Returns the program's output, and a dictionary with the number of
+    allocations, the bytes allocated, and the number of array
+    regrowths.
+    """
+    output, _, _ = run_once(program, args)
+    with open(program + '.profile.json') as report:
+        sites = json.load(report)['alloc_sites']
+    return output, {
+        'allocations': sum(site['allocations'] for site in sites),
+        'allocated_bytes': sum(site['bytes'] for site in sites),
+        'regrowths': sum(site['regrowths'] for site in sites),
+    }
+
+
+def bench_workload(name, build_dir, options, wrapper):
+    """Benchmark the named workload, returning a dictionary of results.
+
+    The program is run through the given peak_rss wrapper.
+    """
+    args = WORKLOADS[name]
+    program = compile_workload(name, build_dir, options)
+    times = []
+    peak_rss_kb = 0
+    output = None
+    for _ in range(options.repeat):
+        output, elapsed, peak = run_once(program, args, wrapper)
+        times.append(elapsed)
+        peak_rss_kb = max(peak_rss_kb, peak)
+    result = {
+        'args': args,
+        'median_s': statistics.median(times),
+        'times_s': times,
+        'peak_rss_kb': peak_rss_kb,
+    }
+    if not options.no_alloc:
+        profiled = compile_workload(name, build_dir, options, 'alloc')
+        profiled_output, counts = count_allocations(profiled, args)
+        if profiled_output != output:
+            raise RuntimeError(f'{name}: output of allocation-profiled '
+                               'build differs')
+        result.update(counts)
+    return result
+
+
+def print_table(results):
+    """Print a table of benchmark results to standard out."""
+    print(f'{"workload":16}{"median s":>12}{"peak RSS KB":>14}'
+          f'{"allocations":>14}{"regrowths":>12}')
+    for name, result in results.items():
+        print(f'{name:16}{result["median_s"]:>12.4f}'
+              f'{result["peak_rss_kb"]:>14}'
+              f'{result.get("allocations", "-"):>14}'
+              f'{result.get("regrowths", "-"):>12}')
+
+
+def main():
+    """Command-line interface."""
+    aparser = argparse.ArgumentParser(description='Run the uC runtime '
+                                      'benchmark suite.')
+    aparser.add_argument('workloads', nargs='*',
+                         help='workloads to run (default: all of '
+                         + ', '.join(WORKLOADS) + ')')
+    aparser.add_argument('--repeat', type=int, default=5,
+                         help='number of timed runs of each workload')
+    aparser.add_argument('--cxx', default='g++', help='C++ compiler')
+    aparser.add_argument('--cxxflags',
+                         default='-O2 --std=c++17 -pthread',
+                         help='C++ compiler flags')
+    aparser.add_argument('--lib-dir',
+                         default=os.path.join(REPO_DIR, 'include'),
+                         help='directory containing the uC library')
+    aparser.add_argument('--build-dir',
+                         default=os.path.join(BENCH_DIR, 'build'),
+                         help='directory for generated files')
+    aparser.add_argument('--out', help='write results as JSON to this '
+                         'file')
+    aparser.add_argument('--no-alloc', action='store_true',
+                         help='skip counting allocations')
+    options = aparser.parse_args()
+    for name in options.workloads:
+        if name not in WORKLOADS:
+            aparser.error(f'unknown workload: {name}')
+    options.lib_dir = os.path.abspath(options.lib_dir)
+    os.makedirs(options.build_dir, exist_ok=True)
+
+    wrapper = compile_wrapper(options.build_dir, options)
+    results = {}
+    for name in options.workloads or WORKLOADS:
+        print(f'Running {name}...', file=sys.stderr)
+        results[name] = bench_workload(name, options.build_dir, options,
+                                       wrapper)
+    print_table(results)
+    if options.out:
+        with open(options.out, 'w') as out:
+            json.dump({'cxx': options.cxx, 'cxxflags': options.cxxflags,
+                       'repeat': options.repeat, 'workloads': results},
+                      out, indent=2)
+            out.write('\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,26 @@
+/**
+ * Benchmark: building strings by concatenation and conversion. The
+ * number of lines built is given by the first argument.
+ */
+
+void main(string[] args)(int n, int i, int j, string line,
+                         string[] lines, int total) {
+  n = 20000;
+  if (args.length > 0) {
+    n = string_to_int(args[0]);
+  }
+  lines = new string{};
+  for (i = 0; i < n; ++i) {
+    line = "";
+    for (j = 0; j < 50; ++j) {
+      line = line + (i * 50 + j) + ",";
+    }
+    lines << line + int_to_string(i) + "\n";
+  }
+  total = 0;
+  for (i = 0; i < lines.length; ++i) {
+    total = total + length(lines[i]) +
+            ordinal(substr(lines[i], 0, 1));
+  }
+  println("total: " + total);
+}
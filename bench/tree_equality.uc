@@ -0,0 +1,44 @@
+/**
+ * Benchmark: structural equality of deep binary trees, which compares
+ * the trees field by field. The depth of the trees is given by the
+ * first argument.
+ */
+
+struct tree(int value, tree left, tree right);
+
+void main(string[] args)(int depth, int i, tree a, tree b, tree c,
+                         int equal) {
+  depth = 18;
+  if (args.length > 0) {
+    depth = string_to_int(args[0]);
+  }
+  a = build(depth, 1);
+  b = build(depth, 1);
+  c = build(depth, 1);
+  change_last(c);
+  equal = 0;
+  for (i = 0; i < 10; ++i) {
+    if (a == b) {
+      equal = equal + 1;
+    }
+    if (a == c) {
+      equal = equal + 100;
+    }
+  }
+  println("equal: " + equal);
+}
+
+tree build(int depth, int value)() {
+  if (depth == 1) {
+    return new tree(value, null, null);
+  }
+  return new tree(value, build(depth - 1, value * 2 % 1000003),
+                  build(depth - 1, (value * 2 + 1) % 1000003));
+}
+
+void change_last(tree t)() {
+  while (t.right != null) {
+    t = t.right;
+  }
+  t.value = t.value + 1;
+}
@@ -9,6 +9,7 @@
  * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
  */
 
+#include <algorithm>
 #include <initializer_list>
 #include <iostream>
 
@@ -26,23 +27,43 @@ namespace uc
     std::size_t num_elements;
     std::size_t capacity;
     T *elements;
-    void renum_elements()
+#ifdef UC_PROFILE_ALLOC
+    uc_alloc_site *alloc_site = nullptr;
+#endif
+    void reallocate(std::size_t new_capacity)
     {
-      capacity = 2 * capacity + 1;
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_regrow(alloc_site, capacity * sizeof(T),
+                        new_capacity * sizeof(T));
+#endif
+      capacity = new_capacity;
       T *tmp = new T[capacity];
       for (std::size_t i = 0; i < num_elements; i++)
       {
-        tmp[i] = elements[i];
+        tmp[i] = std::move(elements[i]);
       }
       delete[] elements;
       elements = tmp;
     }
+    void renum_elements()
+    {
+      reallocate(2 * capacity + 1);
+    }
 
   public:
+    using value_type = T;
+
     vector()
         : num_elements(0),
           capacity(INITIAL_CAPACITY),
           elements(new T[INITIAL_CAPACITY]) {}
+    // Construct a vector of the given size, with each element
+    // value-initialized, in a single allocation of exactly that size.
+    explicit vector(std::size_t size)
+        : num_elements(size),
+          capacity(size),
+          elements(new T[size]()) {}
     vector(const vector &rhs)
         : num_elements(rhs.num_elements),
           capacity(rhs.capacity),
@@ -57,6 +78,11 @@ namespace uc
     {
       if (rhs == *this)
         return *this;
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_regrow(alloc_site, capacity * sizeof(T),
+                        rhs.capacity * sizeof(T));
+#endif
       delete[] elements;
       num_elements = rhs.num_elements;
       capacity = rhs.capacity;
@@ -67,7 +93,28 @@ namespace uc
       }
       return *this;
     }
-    ~vector() { delete[] elements; }
+    ~vector()
+    {
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_free(alloc_site, capacity * sizeof(T));
+#endif
+      delete[] elements;
+    }
+#ifdef UC_PROFILE_ALLOC
+    // Record the buffer of this vector, and any later reallocation of
+    // it, against the given allocation site.
+    void attach(uc_alloc_site *site)
+    {
+      alloc_site = site;
+      uc_alloc_buffer(site, capacity * sizeof(T));
+    }
+#endif
+    void reserve(std::size_t new_capacity)
+    {
+      if (new_capacity > capacity)
+        reallocate(new_capacity);
+    }
     void push_back(const T &item)
     {
       if (num_elements == capacity)
@@ -88,6 +135,10 @@ namespace uc
       return elements[i];
     }
     std::size_t size() const { return num_elements; }
+    T *begin() { return elements; }
+    const T *begin() const { return elements; }
+    T *end() { return elements + num_elements; }
+    const T *end() const { return elements + num_elements; }
     bool operator==(const vector &rhs) const
     {
       if (num_elements != rhs.num_elements)
@@ -110,12 +161,29 @@ namespace uc
       }
       return false;
     }
+    std::size_t uc_hash() const
+    {
+      std::size_t hash = num_elements;
+      for (std::size_t i = 0; i < num_elements; i++)
+      {
+        hash = uc_hash_combine(hash, uc::uc_hash(elements[i]));
+      }
+      return hash;
+    }
   };
 
   // Type alias template for a uC array.
   template <class T>
   using UC_PREFIX(array) = uc_reference<vector<T>>;
 
+#ifdef UC_PROFILE_ALLOC
+  template <class T>
+  void uc_alloc_attach(vector<T> &vec, uc_alloc_site *site)
+  {
+    vec.attach(site);
+  }
+#endif
+
   // Compute the length of a uC array.
   template <class A>
   UC_PRIMITIVE(int)
@@ -162,15 +230,16 @@ namespace uc
     return array;
   }
 
-  // Construct a uC array containing the given elements. This template
-  // should be explicitly instantiated when it is called, e.g.
-  // uc_make_array_of<UC_PRIMITIVE(int)>(...).
+  // Construct a uC array containing the given elements at the given
+  // allocation site. This template should be explicitly instantiated
+  // when it is called, e.g. uc_make_array_of_at<UC_PRIMITIVE(int)>(...).
   template <class T, class... Args>
   UC_ARRAY(T)
-  uc_make_array_of(Args... args)
+  uc_make_array_of_at(uc_alloc_site *site, Args... args)
   {
     std::initializer_list<T> inits = {static_cast<T>(args)...};
-    auto vec = uc_make_object<uc_reference<vector<T>>>();
+    auto vec = uc_make_object_at<uc_reference<vector<T>>>(site);
+    vec->reserve(inits.size());
     for (auto &init : inits)
     {
       uc_array_push(vec, init);
@@ -178,6 +247,46 @@ namespace uc
     return vec;
   }
 
+  // Construct a uC array containing the given elements. This template
+  // should be explicitly instantiated when it is called, e.g.
+  // uc_make_array_of<UC_PRIMITIVE(int)>(...).
+  template <class T, class... Args>
+  UC_ARRAY(T)
+  uc_make_array_of(Args... args)
+  {
+    return uc_make_array_of_at<T>(nullptr, args...);
+  }
+
+  // Construct a uC array of the given size at the given allocation
+  // site, with each element value-initialized, in a single allocation.
+  // Aborts if the size is negative. This template should be explicitly
+  // instantiated when it is called, e.g.
+  // uc_make_array_of_size_at<UC_PRIMITIVE(int)>(site, n).
+  template <class T, class S>
+  UC_ARRAY(T)
+  uc_make_array_of_size_at(uc_alloc_site *site, S size)
+  {
+    if (size < 0)
+    {
+      std::cerr << "Error: negative array size: " << std::to_string(size)
+                << std::endl;
+      std::abort();
+    }
+    return uc_make_object_at<uc_reference<vector<T>>>(
+        site, static_cast<std::size_t>(size));
+  }
+
+  // Construct a uC array of the given size, with each element
+  // value-initialized, in a single allocation. This template should be
+  // explicitly instantiated when it is called, e.g.
+  // uc_make_array_of_size<UC_PRIMITIVE(int)>(n).
+  template <class T, class S>
+  UC_ARRAY(T)
+  uc_make_array_of_size(S size)
+  {
+    return uc_make_array_of_size_at<T>(nullptr, size);
+  }
+
   // Indexes into a uC array, returning the associated element.
   // Performs bounds checking.
   template <class A, class U>
@@ -192,4 +301,225 @@ namespace uc
     return (*array)[i];
   }
 
+  // Function object that orders uC array elements with uc_less().
+  struct uc_element_less
+  {
+    template <class T>
+    bool operator()(const T &a, const T &b) const
+    {
+      return uc_less(a, b);
+    }
+  };
+
+  // Built-in sort() function. Sorts a uC array in place in ascending
+  // order, working directly on the array's contiguous storage.
+  template <class T>
+  void UC_FUNCTION(sort)(UC_ARRAY(T) array)
+  {
+    std::sort(array->begin(), array->end(), uc_element_less());
+  }
+
+  // Built-in reserve() function. Ensures that a uC array has room for
+  // at least the given number of elements, so that pushing up to that
+  // many elements does not reallocate its storage.
+  template <class T>
+  void UC_FUNCTION(reserve)(UC_ARRAY(T) array, UC_PRIMITIVE(int) capacity)
+  {
+    if (capacity > 0)
+    {
+      array->reserve(static_cast<std::size_t>(capacity));
+    }
+  }
+
+  // Built-in binary_search() function. Searches a sorted uC array for
+  // the given item, returning the index of a matching element, or -1
+  // if there is none.
+  template <class T>
+  UC_PRIMITIVE(int)
+  UC_FUNCTION(binary_search)(UC_ARRAY(T) array,
+                             const typename vector<T>::value_type &item)
+  {
+    auto pos = std::lower_bound(array->begin(), array->end(), item,
+                                uc_element_less());
+    if (pos == array->end() || uc_less(item, *pos))
+    {
+      return -1;
+    }
+    return static_cast<UC_PRIMITIVE(int)>(pos - array->begin());
+  }
+
+  // Rectangular two-dimensional array stored as a single contiguous
+  // buffer in row-major order.
+  template <class T>
+  class matrix
+  {
+    std::size_t num_rows;
+    std::size_t num_cols;
+    T *elements;
+#ifdef UC_PROFILE_ALLOC
+    uc_alloc_site *alloc_site = nullptr;
+#endif
+
+  public:
+    using value_type = T;
+
+    matrix() : num_rows(0), num_cols(0), elements(new T[0]) {}
+    // Construct a matrix of the given dimensions, with each element
+    // value-initialized, in a single allocation.
+    matrix(std::size_t rows, std::size_t cols)
+        : num_rows(rows),
+          num_cols(cols),
+          elements(new T[rows * cols]()) {}
+    matrix(const matrix &rhs)
+        : num_rows(rhs.num_rows),
+          num_cols(rhs.num_cols),
+          elements(new T[rhs.size()])
+    {
+      std::copy(rhs.begin(), rhs.end(), elements);
+    }
+    matrix &operator=(const matrix &rhs)
+    {
+      if (this == &rhs)
+        return *this;
+      T *tmp = new T[rhs.size()];
+      std::copy(rhs.begin(), rhs.end(), tmp);
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_regrow(alloc_site, size() * sizeof(T),
+                        rhs.size() * sizeof(T));
+#endif
+      delete[] elements;
+      elements = tmp;
+      num_rows = rhs.num_rows;
+      num_cols = rhs.num_cols;
+      return *this;
+    }
+    ~matrix()
+    {
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_free(alloc_site, size() * sizeof(T));
+#endif
+      delete[] elements;
+    }
+#ifdef UC_PROFILE_ALLOC
+    // Record the buffer of this matrix against the given allocation
+    // site.
+    void attach(uc_alloc_site *site)
+    {
+      alloc_site = site;
+      uc_alloc_buffer(site, size() * sizeof(T));
+    }
+#endif
+    std::size_t rows() const { return num_rows; }
+    std::size_t cols() const { return num_cols; }
+    std::size_t size() const { return num_rows * num_cols; }
+    T &at(std::size_t i, std::size_t j) { return elements[i * num_cols + j]; }
+    const T &at(std::size_t i, std::size_t j) const
+    {
+      return elements[i * num_cols + j];
+    }
+    T *begin() { return elements; }
+    const T *begin() const { return elements; }
+    T *end() { return elements + size(); }
+    const T *end() const { return elements + size(); }
+    bool operator==(const matrix &rhs) const
+    {
+      return num_rows == rhs.num_rows && num_cols == rhs.num_cols &&
+             std::equal(begin(), end(), rhs.begin());
+    }
+    bool operator!=(const matrix &rhs) const
+    {
+      return !(*this == rhs);
+    }
+    std::size_t uc_hash() const
+    {
+      std::size_t hash = uc_hash_combine(num_rows, num_cols);
+      for (std::size_t i = 0; i < size(); i++)
+      {
+        hash = uc_hash_combine(hash, uc::uc_hash(elements[i]));
+      }
+      return hash;
+    }
+  };
+
+  // Type alias template for a uC matrix.
+  template <class T>
+  using UC_PREFIX(matrix) = uc_reference<matrix<T>>;
+
+#ifdef UC_PROFILE_ALLOC
+  template <class T>
+  void uc_alloc_attach(matrix<T> &mat, uc_alloc_site *site)
+  {
+    mat.attach(site);
+  }
+#endif
+
+  // Construct a uC matrix of the given dimensions at the given
+  // allocation site, with each element value-initialized. Aborts if
+  // either dimension is negative. This template should be explicitly
+  // instantiated when it is called, e.g.
+  // uc_make_matrix_of_size_at<UC_PRIMITIVE(int)>(site, rows, cols).
+  template <class T, class R, class C>
+  UC_MATRIX(T)
+  uc_make_matrix_of_size_at(uc_alloc_site *site, R rows, C cols)
+  {
+    if (rows < 0 || cols < 0)
+    {
+      std::cerr << "Error: negative matrix size: " << std::to_string(rows)
+                << ", " << std::to_string(cols) << std::endl;
+      std::abort();
+    }
+    return uc_make_object_at<uc_reference<matrix<T>>>(
+        site, static_cast<std::size_t>(rows),
+        static_cast<std::size_t>(cols));
+  }
+
+  // Construct a uC matrix of the given dimensions, with each element
+  // value-initialized. This template should be explicitly instantiated
+  // when it is called, e.g.
+  // uc_make_matrix_of_size<UC_PRIMITIVE(int)>(rows, cols).
+  template <class T, class R, class C>
+  UC_MATRIX(T)
+  uc_make_matrix_of_size(R rows, C cols)
+  {
+    return uc_make_matrix_of_size_at<T>(nullptr, rows, cols);
+  }
+
+  // Compute the number of rows in a uC matrix.
+  template <class M>
+  UC_PRIMITIVE(int)
+  uc_matrix_rows(M mat)
+  {
+    return static_cast<UC_PRIMITIVE(int)>(mat->rows());
+  }
+
+  // Compute the number of columns in a uC matrix.
+  template <class M>
+  UC_PRIMITIVE(int)
+  uc_matrix_cols(M mat)
+  {
+    return static_cast<UC_PRIMITIVE(int)>(mat->cols());
+  }
+
+  // Indexes into a uC matrix, returning the associated element.
+  // Performs bounds checking on both indices with a single test, by
+  // comparing them as unsigned values so that negative indices are
+  // also out of bounds.
+  template <class M, class I, class J>
+  auto uc_matrix_index(M mat, I i, J j) -> decltype(mat->at(i, j)) &
+  {
+    auto &m = *mat;
+    if ((static_cast<std::size_t>(i) >= m.rows()) |
+        (static_cast<std::size_t>(j) >= m.cols()))
+    {
+      std::cerr << "Error: matrix index out of bounds: 0 <= "
+                << std::to_string(i) << " < " << std::to_string(m.rows())
+                << ", 0 <= " << std::to_string(j) << " < "
+                << std::to_string(m.cols()) << std::endl;
+      std::abort();
+    }
+    return m.at(i, j);
+  }
+
 } // namespace uc
@@ -27,8 +27,21 @@
 // A user-defined type wrapped in a reference
 #define UC_REFERENCE(name) uc_reference<UC_PREFIX(UC_CONCAT(t_, name))>
 
-// An array type with the given element type
-#define UC_ARRAY(elem_type) UC_PREFIX(array<elem_type>)
+// A value struct type of the given name, which is stored inline
+// rather than through a reference
+#define UC_VALUE(name) UC_TYPEDEF(name)
+
+// An array type with the given element type. The element type is
+// taken as variadic arguments, since it may itself contain a comma
+// (e.g. an array of maps).
+#define UC_ARRAY(...) UC_PREFIX(array)<__VA_ARGS__>
+
+// A rectangular two-dimensional array type with the given element
+// type
+#define UC_MATRIX(...) UC_PREFIX(matrix)<__VA_ARGS__>
+
+// A map type with the given key and value types
+#define UC_MAP(key_type, value_type) UC_PREFIX(map)<key_type, value_type>
 
 // A function of the given name
 #define UC_FUNCTION(name) UC_PREFIX(UC_CONCAT(f_, name))
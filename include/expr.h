@@ -5,12 +5,16 @@
  *
  * This file includes function template overloads for polymorphic
  * operations, specifically obtaining the id of an object, accessing
- * the length field of an object, and adding two values together.
+ * the length, rows, and cols fields of an object, and adding two
+ * values together.
  *
  * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
  */
 
 #include "array.h"
+#include "map.h"
+#include "parallel.h"
+#include "numeric.h"
 
 namespace uc {
 
@@ -23,9 +27,10 @@ uc_id(T ref) {
 }
 
 // Basic template for accessing the length field of a non-array
-// object.
+// object. The object is taken by reference, so that the field of a
+// value struct is accessed in place rather than in a copy.
 template <class T>
-auto uc_length_field(T ref) -> decltype(ref->UC_VAR(length))& {
+auto uc_length_field(T &&ref) -> decltype(ref->UC_VAR(length))& {
   return ref->UC_VAR(length);
 }
 
@@ -36,6 +41,36 @@ uc_length_field(UC_ARRAY(E) array) {
   return uc_array_length(array);
 }
 
+template <class K, class V>
+UC_PRIMITIVE(int)
+uc_length_field(UC_MAP(K, V) map) {
+  return uc_map_length(map);
+}
+
+// Basic templates for accessing the rows and cols fields of a
+// non-matrix object, taken by reference as for length.
+template <class T>
+auto uc_rows_field(T &&ref) -> decltype(ref->UC_VAR(rows))& {
+  return ref->UC_VAR(rows);
+}
+
+template <class T>
+auto uc_cols_field(T &&ref) -> decltype(ref->UC_VAR(cols))& {
+  return ref->UC_VAR(cols);
+}
+
+template <class E>
+UC_PRIMITIVE(int)
+uc_rows_field(UC_MATRIX(E) mat) {
+  return uc_matrix_rows(mat);
+}
+
+template <class E>
+UC_PRIMITIVE(int)
+uc_cols_field(UC_MATRIX(E) mat) {
+  return uc_matrix_cols(mat);
+}
+
 // define your overloads for uc_add() here
 
 // both numeric
@@ -49,7 +84,7 @@ N uc_add(N a, N b) {
 }
 
 // both strings
-UC_PRIMITIVE(string) uc_add(UC_PRIMITIVE(string) a, UC_PRIMITIVE(string) b) {
+inline UC_PRIMITIVE(string) uc_add(UC_PRIMITIVE(string) a, UC_PRIMITIVE(string) b) {
   return a + b;
 }
 
@@ -67,12 +102,12 @@ uc_add(N a, UC_PRIMITIVE(string) b) {
 }
 
 // one string one boolean
-UC_PRIMITIVE(string)
+inline UC_PRIMITIVE(string)
 uc_add(UC_PRIMITIVE(string) a, UC_PRIMITIVE(boolean) b) {
   return a + (b ? "true" : "false");
 }
 
-UC_PRIMITIVE(string)
+inline UC_PRIMITIVE(string)
 uc_add(UC_PRIMITIVE(boolean) a, UC_PRIMITIVE(string) b) {
   return (a ? "true" : "false") + b;
 }
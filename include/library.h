@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <cmath>
 #include "defs.h"
@@ -80,6 +81,69 @@ namespace uc {
     return i == "false" ? false : true;
   }
 
+  // Orderings between primitive values, used by the sort() and
+  // binary_search() built-ins. NaN is ordered after every other float
+  // and equivalent to itself, so that the float ordering remains a
+  // strict weak ordering.
+  static bool uc_less(UC_PRIMITIVE(int) a, UC_PRIMITIVE(int) b) {
+    return a < b;
+  }
+
+  static bool uc_less(UC_PRIMITIVE(long) a, UC_PRIMITIVE(long) b) {
+    return a < b;
+  }
+
+  static bool uc_less(UC_PRIMITIVE(float) a, UC_PRIMITIVE(float) b) {
+    if (std::isnan(b)) {
+      return !std::isnan(a);
+    }
+    return a < b;
+  }
+
+  static bool uc_less(const UC_PRIMITIVE(string) &a,
+                      const UC_PRIMITIVE(string) &b) {
+    return a < b;
+  }
+
+  // Hashes of primitive values, used by the map built-in type. Values
+  // that compare equal have equal hashes.
+  static std::size_t uc_hash(UC_PRIMITIVE(int) i) {
+    return std::hash<UC_PRIMITIVE(int)>()(i);
+  }
+
+  static std::size_t uc_hash(UC_PRIMITIVE(long) i) {
+    return std::hash<UC_PRIMITIVE(long)>()(i);
+  }
+
+  static std::size_t uc_hash(UC_PRIMITIVE(float) i) {
+    return std::hash<UC_PRIMITIVE(float)>()(i);
+  }
+
+  static std::size_t uc_hash(UC_PRIMITIVE(boolean) i) {
+    return std::hash<UC_PRIMITIVE(boolean)>()(i);
+  }
+
+  static std::size_t uc_hash(const UC_PRIMITIVE(string) &i) {
+    return std::hash<UC_PRIMITIVE(string)>()(i);
+  }
+
+  // Ordering and hash of a value struct, through its generated
+  // uc_less() and uc_hash() member functions.
+  template<class T>
+  auto uc_less(const T &a, const T &b) -> decltype(a.uc_less(b)) {
+    return a.uc_less(b);
+  }
+
+  template<class T>
+  auto uc_hash(const T &v) -> decltype(v.uc_hash()) {
+    return v.uc_hash();
+  }
+
+  // Combine a hash into a running hash of a compound value.
+  static std::size_t uc_hash_combine(std::size_t seed, std::size_t hash) {
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+  }
+
   // Built-in length() function. Takes a string and returns its length.
   static UC_PRIMITIVE(int) UC_FUNCTION(length)(UC_PRIMITIVE(string) s) {
     return static_cast<UC_PRIMITIVE(int)>(s.length());
@@ -135,16 +199,35 @@ namespace uc {
     return std::floor(i);
   }
 
+#ifdef UC_THREADED
+  // The buffer to which the current thread writes output, or null if
+  // it writes directly to standard out. Within a parallel loop, each
+  // chunk of iterations writes to its own buffer, and the buffers are
+  // written out in iteration order at the end of the loop.
+  inline thread_local std::ostream *uc_output_buffer = nullptr;
+#endif
+
+  // Return the stream to which the current thread writes output.
+  static std::ostream &uc_output() {
+#ifdef UC_THREADED
+    if (uc_output_buffer) {
+      return *uc_output_buffer;
+    }
+#endif
+    return std::cout;
+  }
+
   // Built-in print() function. Takes a string and prints it to
   // standard out, without a trailing newline.
   static void UC_FUNCTION(print)(UC_PRIMITIVE(string) i) {
-    std::cout << i;
+    uc_output() << i;
   }
 
   // Built-in println() function. Takes a string and prints it to
-  // standard out, with a trailing newline.
+  // standard out, with a trailing newline. Standard out is not flushed,
+  // since std::cin and std::cerr flush it when needed.
   static void UC_FUNCTION(println)(UC_PRIMITIVE(string) i) {
-    std::cout << i << std::endl;
+    uc_output() << i << '\n';
   }
 
   // Built-in peekchar() function. Returns the next character in
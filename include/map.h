@@ -0,0 +1,311 @@
+#pragma once
+
+/**
+ * map.h
+ *
+ * This file provides the implementation for uC maps, as well as
+ * operations on them.
+ *
+ * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+#include "library.h"
+#include "ref.h"
+
+namespace uc
+{
+
+  // Hash map implementation using open addressing with linear probing.
+  // Entries are stored inline in a single power-of-two sized table,
+  // along with the full hash of their key, so that a lookup usually
+  // touches a single cache line. Removal shifts later entries of a
+  // probe sequence back rather than leaving tombstones.
+  template <class K, class V>
+  class hash_map
+  {
+    struct slot
+    {
+      std::size_t hash = 0; // 0 marks an empty slot
+      K key{};
+      V value{};
+    };
+
+    static const std::size_t INITIAL_CAPACITY = 16;
+    std::size_t num_elements;
+    std::size_t capacity;
+    slot *slots;
+#ifdef UC_PROFILE_ALLOC
+    uc_alloc_site *alloc_site = nullptr;
+#endif
+
+    // Compute the hash of a key, mixing its bits so that the low bits
+    // can be used as a table index. The result is never 0.
+    static std::size_t hash_of(const K &key)
+    {
+      std::size_t hash = uc::uc_hash(key);
+      hash ^= hash >> 33;
+      hash *= static_cast<std::size_t>(0xff51afd7ed558ccdULL);
+      hash ^= hash >> 33;
+      return hash | 1;
+    }
+
+    // Return the index of the slot containing the given key, or of the
+    // empty slot at which it would be inserted.
+    std::size_t find_slot(const K &key, std::size_t hash) const
+    {
+      std::size_t mask = capacity - 1;
+      std::size_t i = hash & mask;
+      while (slots[i].hash != 0 &&
+             !(slots[i].hash == hash && slots[i].key == key))
+      {
+        i = (i + 1) & mask;
+      }
+      return i;
+    }
+
+    void grow()
+    {
+      slot *old_slots = slots;
+      std::size_t old_capacity = capacity;
+      capacity *= 2;
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_regrow(alloc_site, old_capacity * sizeof(slot),
+                        capacity * sizeof(slot));
+#endif
+      slots = new slot[capacity];
+      for (std::size_t i = 0; i < old_capacity; i++)
+      {
+        if (old_slots[i].hash != 0)
+        {
+          slot &target = slots[find_slot(old_slots[i].key,
+                                         old_slots[i].hash)];
+          target = std::move(old_slots[i]);
+        }
+      }
+      delete[] old_slots;
+    }
+
+  public:
+    using key_type = K;
+    using mapped_type = V;
+
+    hash_map()
+        : num_elements(0),
+          capacity(INITIAL_CAPACITY),
+          slots(new slot[INITIAL_CAPACITY]) {}
+    hash_map(const hash_map &rhs)
+        : num_elements(rhs.num_elements),
+          capacity(rhs.capacity),
+          slots(new slot[rhs.capacity])
+    {
+      for (std::size_t i = 0; i < capacity; i++)
+      {
+        slots[i] = rhs.slots[i];
+      }
+    }
+    hash_map &operator=(const hash_map &rhs)
+    {
+      if (this == &rhs)
+        return *this;
+      slot *tmp = new slot[rhs.capacity];
+      for (std::size_t i = 0; i < rhs.capacity; i++)
+      {
+        tmp[i] = rhs.slots[i];
+      }
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_regrow(alloc_site, capacity * sizeof(slot),
+                        rhs.capacity * sizeof(slot));
+#endif
+      delete[] slots;
+      slots = tmp;
+      num_elements = rhs.num_elements;
+      capacity = rhs.capacity;
+      return *this;
+    }
+    ~hash_map()
+    {
+#ifdef UC_PROFILE_ALLOC
+      if (alloc_site)
+        uc_alloc_free(alloc_site, capacity * sizeof(slot));
+#endif
+      delete[] slots;
+    }
+#ifdef UC_PROFILE_ALLOC
+    // Record the slot table of this map, and any later reallocation
+    // of it, against the given allocation site.
+    void attach(uc_alloc_site *site)
+    {
+      alloc_site = site;
+      uc_alloc_buffer(site, capacity * sizeof(slot));
+    }
+#endif
+
+    std::size_t size() const { return num_elements; }
+
+    // Return a pointer to the value associated with the given key, or
+    // null if the key is not present.
+    V *find(const K &key)
+    {
+      slot &s = slots[find_slot(key, hash_of(key))];
+      return s.hash != 0 ? &s.value : nullptr;
+    }
+    const V *find(const K &key) const
+    {
+      const slot &s = slots[find_slot(key, hash_of(key))];
+      return s.hash != 0 ? &s.value : nullptr;
+    }
+
+    // Associate the given value with the given key, replacing any
+    // existing association.
+    void put(const K &key, const V &value)
+    {
+      std::size_t hash = hash_of(key);
+      std::size_t i = find_slot(key, hash);
+      if (slots[i].hash == 0)
+      {
+        // keep the load factor at or below 3/4
+        if (4 * (num_elements + 1) > 3 * capacity)
+        {
+          grow();
+          i = find_slot(key, hash);
+        }
+        slots[i].hash = hash;
+        slots[i].key = key;
+        num_elements++;
+      }
+      slots[i].value = value;
+    }
+
+    // Remove the given key and its value, returning whether the key
+    // was present.
+    bool remove(const K &key)
+    {
+      std::size_t mask = capacity - 1;
+      std::size_t i = find_slot(key, hash_of(key));
+      if (slots[i].hash == 0)
+        return false;
+      // shift back later entries whose probe sequence passes through
+      // the vacated slot
+      for (std::size_t j = (i + 1) & mask; slots[j].hash != 0;
+           j = (j + 1) & mask)
+      {
+        std::size_t home = slots[j].hash & mask;
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+          slots[i] = std::move(slots[j]);
+          i = j;
+        }
+      }
+      slots[i] = slot();
+      num_elements--;
+      return true;
+    }
+
+    bool operator==(const hash_map &rhs) const
+    {
+      if (num_elements != rhs.num_elements)
+        return false;
+      for (std::size_t i = 0; i < capacity; i++)
+      {
+        if (slots[i].hash != 0)
+        {
+          const V *value = rhs.find(slots[i].key);
+          if (value == nullptr || !(*value == slots[i].value))
+            return false;
+        }
+      }
+      return true;
+    }
+    bool operator!=(const hash_map &rhs) const
+    {
+      return !(*this == rhs);
+    }
+
+    // Hash of the contents of this map, independent of the order of
+    // its entries.
+    std::size_t uc_hash() const
+    {
+      std::size_t hash = num_elements;
+      for (std::size_t i = 0; i < capacity; i++)
+      {
+        if (slots[i].hash != 0)
+        {
+          hash += uc_hash_combine(uc::uc_hash(slots[i].key),
+                                  uc::uc_hash(slots[i].value));
+        }
+      }
+      return hash;
+    }
+  };
+
+  // Type alias template for a uC map.
+  template <class K, class V>
+  using UC_PREFIX(map) = uc_reference<hash_map<K, V>>;
+
+#ifdef UC_PROFILE_ALLOC
+  template <class K, class V>
+  void uc_alloc_attach(hash_map<K, V> &map, uc_alloc_site *site)
+  {
+    map.attach(site);
+  }
+#endif
+
+  // Compute the number of entries in a uC map.
+  template <class M>
+  UC_PRIMITIVE(int)
+  uc_map_length(M map)
+  {
+    return static_cast<UC_PRIMITIVE(int)>(map->size());
+  }
+
+  // Built-in get() function. Returns the value associated with the
+  // given key in a uC map. Aborts if the key is not present.
+  template <class K, class V>
+  V UC_FUNCTION(get)(UC_MAP(K, V) map,
+                     const typename hash_map<K, V>::key_type &key)
+  {
+    V *value = map->find(key);
+    if (value == nullptr)
+    {
+      std::cerr << "Error: key not found in map" << std::endl;
+      std::abort();
+    }
+    return *value;
+  }
+
+  // Built-in put() function. Associates the given value with the
+  // given key in a uC map.
+  template <class K, class V>
+  void UC_FUNCTION(put)(UC_MAP(K, V) map,
+                        const typename hash_map<K, V>::key_type &key,
+                        const typename hash_map<K, V>::mapped_type &value)
+  {
+    map->put(key, value);
+  }
+
+  // Built-in contains() function. Returns whether the given key is
+  // present in a uC map.
+  template <class K, class V>
+  UC_PRIMITIVE(boolean)
+  UC_FUNCTION(contains)(UC_MAP(K, V) map,
+                        const typename hash_map<K, V>::key_type &key)
+  {
+    return map->find(key) != nullptr;
+  }
+
+  // Built-in remove() function. Removes the given key and its value
+  // from a uC map, if it is present.
+  template <class K, class V>
+  void UC_FUNCTION(remove)(UC_MAP(K, V) map,
+                           const typename hash_map<K, V>::key_type &key)
+  {
+    map->remove(key);
+  }
+
+} // namespace uc
@@ -0,0 +1,259 @@
+#pragma once
+
+/**
+ * numeric.h
+ *
+ * This file provides the implementation for the built-in uC
+ * functions that compute over arrays of numbers.
+ *
+ * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "array.h"
+#include "library.h"
+#include "parallel.h"
+
+namespace uc
+{
+
+  // A reduction is computed over fixed-size blocks of an array. Each
+  // block is reduced with a fixed number of independent accumulators,
+  // which the compiler can keep in vector registers. The blocks of a
+  // large array are reduced in parallel, but their results are always
+  // combined in order, so that a floating-point result does not depend
+  // on the number of threads.
+  const std::size_t UC_REDUCE_LANES = 8;
+  const std::size_t UC_REDUCE_BLOCK = 1 << 14;
+  const std::size_t UC_REDUCE_PARALLEL_SIZE = 1 << 16;
+
+  // Reduce the values load(i) for i in [first, last) with the given
+  // operation. Each accumulator starts at init.
+  template <class T, class Op, class Load>
+  T uc_reduce_block(std::size_t first, std::size_t last, T init, Op op,
+                    Load load)
+  {
+    T lanes[UC_REDUCE_LANES];
+    std::fill(lanes, lanes + UC_REDUCE_LANES, init);
+    std::size_t i = first;
+    for (; i + UC_REDUCE_LANES <= last; i += UC_REDUCE_LANES)
+    {
+      for (std::size_t k = 0; k < UC_REDUCE_LANES; k++)
+      {
+        lanes[k] = op(lanes[k], load(i + k));
+      }
+    }
+    for (; i < last; i++)
+    {
+      lanes[0] = op(lanes[0], load(i));
+    }
+    for (std::size_t width = UC_REDUCE_LANES / 2; width > 0; width /= 2)
+    {
+      for (std::size_t k = 0; k < width; k++)
+      {
+        lanes[k] = op(lanes[k], lanes[k + width]);
+      }
+    }
+    return lanes[0];
+  }
+
+  // Reduce the values load(i) for i in [0, size) with the given
+  // operation, for which init must be an identity.
+  template <class T, class Op, class Load>
+  T uc_reduce(std::size_t size, T init, Op op, Load load)
+  {
+    std::size_t num_blocks = (size + UC_REDUCE_BLOCK - 1) / UC_REDUCE_BLOCK;
+    if (num_blocks <= 1)
+      return uc_reduce_block(0, size, init, op, load);
+    std::vector<T> partials(num_blocks);
+    auto reduce = [&](UC_PRIMITIVE(int) block) {
+      std::size_t first = block * UC_REDUCE_BLOCK;
+      std::size_t last = std::min(size, first + UC_REDUCE_BLOCK);
+      partials[block] = uc_reduce_block(first, last, init, op, load);
+    };
+    UC_PRIMITIVE(int) end = static_cast<UC_PRIMITIVE(int)>(num_blocks);
+    if (size >= UC_REDUCE_PARALLEL_SIZE)
+    {
+      uc_parallel_for(0, end, reduce);
+    }
+    else
+    {
+      for (UC_PRIMITIVE(int) block = 0; block < end; block++)
+      {
+        reduce(block);
+      }
+    }
+    T result = partials[0];
+    for (std::size_t block = 1; block < num_blocks; block++)
+    {
+      result = op(result, partials[block]);
+    }
+    return result;
+  }
+
+  // Abort if a uC array is empty, naming the given function.
+  template <class T>
+  void uc_check_nonempty(const UC_ARRAY(T) &array, const char *name)
+  {
+    if (array->size() == 0)
+    {
+      std::cerr << "Error: " << name << " of empty array" << std::endl;
+      std::abort();
+    }
+  }
+
+  // Abort if two uC arrays differ in length, naming the given
+  // function.
+  template <class T>
+  void uc_check_same_length(const UC_ARRAY(T) &array1,
+                            const UC_ARRAY(T) &array2, const char *name)
+  {
+    if (array1->size() != array2->size())
+    {
+      std::cerr << "Error: " << name << " of arrays of different lengths: "
+                << array1->size() << " != " << array2->size() << std::endl;
+      std::abort();
+    }
+  }
+
+  // Built-in sum() function. Returns the sum of the elements of a uC
+  // array, or 0 if it is empty.
+  template <class T>
+  T UC_FUNCTION(sum)(UC_ARRAY(T) array)
+  {
+    const T *data = array->begin();
+    auto add = [](T a, T b) { return a + b; };
+    auto load = [data](std::size_t i) { return data[i]; };
+    return uc_reduce(array->size(), T{}, add, load);
+  }
+
+  // Built-in min() function. Returns the smallest element of a uC
+  // array. Aborts if the array is empty.
+  template <class T>
+  T UC_FUNCTION(min)(UC_ARRAY(T) array)
+  {
+    uc_check_nonempty(array, "min");
+    const T *data = array->begin();
+    auto smaller = [](T a, T b) { return b < a ? b : a; };
+    auto load = [data](std::size_t i) { return data[i]; };
+    return uc_reduce(array->size(), data[0], smaller, load);
+  }
+
+  // Built-in max() function. Returns the largest element of a uC
+  // array. Aborts if the array is empty.
+  template <class T>
+  T UC_FUNCTION(max)(UC_ARRAY(T) array)
+  {
+    uc_check_nonempty(array, "max");
+    const T *data = array->begin();
+    auto larger = [](T a, T b) { return a < b ? b : a; };
+    auto load = [data](std::size_t i) { return data[i]; };
+    return uc_reduce(array->size(), data[0], larger, load);
+  }
+
+  // Built-in dot() function. Returns the dot product of two uC arrays.
+  // Aborts if their lengths differ.
+  template <class T>
+  T UC_FUNCTION(dot)(UC_ARRAY(T) array1, UC_ARRAY(T) array2)
+  {
+    uc_check_same_length(array1, array2, "dot");
+    const T *__restrict data1 = array1->begin();
+    const T *__restrict data2 = array2->begin();
+    auto add = [](T a, T b) { return a + b; };
+    auto load = [data1, data2](std::size_t i) { return data1[i] * data2[i]; };
+    return uc_reduce(array1->size(), T{}, add, load);
+  }
+
+  // The element-wise built-in functions below work on float arrays
+  // through restrict-qualified pointers to their storage, so that the
+  // compiler can vectorize their loops. They are templates over the
+  // element type, which is always float, so that a user function of
+  // the same name is preferred to them.
+
+  // Built-in sqrt_all() function. Returns a new uC array of the square
+  // roots of the elements of a uC array.
+  template <class T>
+  UC_ARRAY(T) UC_FUNCTION(sqrt_all)(UC_ARRAY(T) array)
+  {
+    std::size_t size = array->size();
+    auto result = uc_make_array_of_size<T>(size);
+    const T *__restrict in = array->begin();
+    T *__restrict out = result->begin();
+    for (std::size_t i = 0; i < size; i++)
+    {
+      out[i] = std::sqrt(in[i]);
+    }
+    return result;
+  }
+
+  // Built-in axpy() function. Adds a times each element of the uC
+  // array x to the corresponding element of the uC array y, in place.
+  // Aborts if the lengths of x and y differ.
+  template <class T>
+  void UC_FUNCTION(axpy)(UC_PRIMITIVE(float) a, UC_ARRAY(T) x,
+                         UC_ARRAY(T) y)
+  {
+    uc_check_same_length(x, y, "axpy");
+    std::size_t size = x->size();
+    const T *__restrict in = x->begin();
+    T *__restrict out = y->begin();
+    if (in == out)
+    {
+      // x and y are the same array
+      for (std::size_t i = 0; i < size; i++)
+      {
+        out[i] += a * out[i];
+      }
+      return;
+    }
+    for (std::size_t i = 0; i < size; i++)
+    {
+      out[i] += a * in[i];
+    }
+  }
+
+  // Apply an operation to the corresponding elements of two uC
+  // arrays, returning a new array of the results. Aborts if the
+  // lengths of the arrays differ.
+  template <class T, class Op>
+  UC_ARRAY(T)
+  uc_elementwise(UC_ARRAY(T) array1, UC_ARRAY(T) array2, Op op,
+                 const char *name)
+  {
+    uc_check_same_length(array1, array2, name);
+    std::size_t size = array1->size();
+    auto result = uc_make_array_of_size<T>(size);
+    const T *__restrict in1 = array1->begin();
+    const T *__restrict in2 = array2->begin();
+    T *__restrict out = result->begin();
+    for (std::size_t i = 0; i < size; i++)
+    {
+      out[i] = op(in1[i], in2[i]);
+    }
+    return result;
+  }
+
+  // Built-in add_all() function. Returns a new uC array of the sums of
+  // the corresponding elements of two uC arrays.
+  template <class T>
+  UC_ARRAY(T) UC_FUNCTION(add_all)(UC_ARRAY(T) array1, UC_ARRAY(T) array2)
+  {
+    auto add = [](T a, T b) { return a + b; };
+    return uc_elementwise(array1, array2, add, "add_all");
+  }
+
+  // Built-in mul_all() function. Returns a new uC array of the
+  // products of the corresponding elements of two uC arrays.
+  template <class T>
+  UC_ARRAY(T) UC_FUNCTION(mul_all)(UC_ARRAY(T) array1, UC_ARRAY(T) array2)
+  {
+    auto mul = [](T a, T b) { return a * b; };
+    return uc_elementwise(array1, array2, mul, "mul_all");
+  }
+
+} // namespace uc
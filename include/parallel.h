@@ -0,0 +1,284 @@
+#pragma once
+
+/**
+ * parallel.h
+ *
+ * This file provides the runtime support for uC parallel for loops: a
+ * pool of worker threads that divides the iterations of a loop among
+ * its workers through work stealing.
+ *
+ * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "library.h"
+
+namespace uc
+{
+
+  // Pool of worker threads that run a task together. The thread that
+  // starts a task participates in it as worker 0, so a pool of size 1
+  // has no threads of its own.
+  class thread_pool
+  {
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    const std::function<void(std::size_t)> *task = nullptr;
+    std::size_t generation = 0;
+    std::size_t num_running = 0;
+    bool stopping = false;
+
+    // whether the current thread is running a task of some pool
+    static inline thread_local bool in_task = false;
+
+    void work(std::size_t id)
+    {
+      std::size_t seen = 0;
+      while (true)
+      {
+        const std::function<void(std::size_t)> *current;
+        {
+          std::unique_lock<std::mutex> guard(lock);
+          start_cv.wait(guard, [&]() { return stopping ||
+                                              generation != seen; });
+          if (stopping)
+            return;
+          seen = generation;
+          current = task;
+        }
+        in_task = true;
+        (*current)(id);
+        in_task = false;
+        std::lock_guard<std::mutex> guard(lock);
+        if (--num_running == 0)
+          done_cv.notify_one();
+      }
+    }
+
+  public:
+    explicit thread_pool(std::size_t size)
+    {
+      for (std::size_t id = 1; id < size; id++)
+      {
+        threads.emplace_back(&thread_pool::work, this, id);
+      }
+    }
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+    ~thread_pool()
+    {
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+      }
+      start_cv.notify_all();
+      for (auto &thread : threads)
+      {
+        thread.join();
+      }
+    }
+
+    std::size_t size() const { return threads.size() + 1; }
+
+    // Run the given task on every worker, passing each its id, and
+    // wait for all of them to finish.
+    void run(const std::function<void(std::size_t)> &current)
+    {
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        task = &current;
+        num_running = threads.size();
+        generation++;
+      }
+      start_cv.notify_all();
+      in_task = true;
+      current(0);
+      in_task = false;
+      std::unique_lock<std::mutex> guard(lock);
+      done_cv.wait(guard, [&]() { return num_running == 0; });
+    }
+
+    // Return whether the current thread is running a task, in which
+    // case a nested parallel loop should run serially.
+    static bool in_parallel() { return in_task; }
+
+    // Return the pool shared by all parallel loops. Its size is given
+    // by the UC_NUM_THREADS environment variable if it is set, or the
+    // number of hardware threads otherwise.
+    static thread_pool &instance()
+    {
+      static thread_pool pool(default_size());
+      return pool;
+    }
+
+    static std::size_t default_size()
+    {
+      const char *setting = std::getenv("UC_NUM_THREADS");
+      long size = setting ? std::atol(setting) : 0;
+      if (size > 0)
+        return static_cast<std::size_t>(size);
+      unsigned hardware = std::thread::hardware_concurrency();
+      return hardware > 0 ? hardware : 1;
+    }
+  };
+
+  // Range of loop iterations owned by a worker. The owner takes chunks
+  // from the front of its range, and a worker whose range is empty
+  // steals the back half of another's.
+  struct alignas(64) uc_iteration_range
+  {
+    std::mutex lock;
+    long begin = 0;
+    long end = 0;
+
+    // Take up to size iterations from the front of this range,
+    // returning whether there were any.
+    bool take(long size, long &first, long &last)
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      if (begin == end)
+        return false;
+      first = begin;
+      last = begin = std::min(begin + size, end);
+      return true;
+    }
+
+    // Remove the back half of this range, returning whether it was
+    // non-empty.
+    bool split(long &first, long &last)
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      if (begin == end)
+        return false;
+      first = end - (end - begin + 1) / 2;
+      last = end;
+      end = first;
+      return true;
+    }
+
+    void reset(long first, long last)
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      begin = first;
+      end = last;
+    }
+  };
+
+  // Output written by the chunks of a parallel loop, which is written
+  // out in iteration order once the loop is complete, so that the
+  // output does not depend on how the iterations were scheduled.
+  class uc_ordered_output
+  {
+    std::mutex lock;
+    std::vector<std::pair<long, std::string>> chunks;
+
+  public:
+    // Record the output of the chunk of iterations starting at first.
+    void add(long first, std::string text)
+    {
+      if (text.empty())
+        return;
+      std::lock_guard<std::mutex> guard(lock);
+      chunks.emplace_back(first, std::move(text));
+    }
+
+    // Write the recorded output to the given stream, ordered by the
+    // first iteration of each chunk.
+    void write(std::ostream &out)
+    {
+      std::sort(chunks.begin(), chunks.end());
+      for (auto &chunk : chunks)
+      {
+        out << chunk.second;
+      }
+    }
+  };
+
+  // Run body(i) for each i in [begin, end), distributing the
+  // iterations across the shared thread pool, and return the value of
+  // the loop variable after the loop. The iterations must be
+  // independent of each other. Runs serially when nested within
+  // another parallel loop. end is a long, so that a loop up to and
+  // including the largest int does not overflow.
+  template <class F>
+  UC_PRIMITIVE(int)
+  uc_parallel_for(UC_PRIMITIVE(int) begin, UC_PRIMITIVE(long) end, F body)
+  {
+    if (end <= begin)
+      return begin;
+    if (end - begin == 1 || thread_pool::in_parallel() ||
+        thread_pool::instance().size() == 1)
+    {
+      for (UC_PRIMITIVE(long) i = begin; i < end; i++)
+      {
+        body(static_cast<UC_PRIMITIVE(int)>(i));
+      }
+      return static_cast<UC_PRIMITIVE(int)>(end);
+    }
+
+    thread_pool &pool = thread_pool::instance();
+    std::size_t num_workers = pool.size();
+    long workers = static_cast<long>(num_workers);
+    long count = static_cast<long>(end) - begin;
+    // several chunks per worker, so that uneven iterations balance
+    long chunk = std::max(1L, count / (8 * workers));
+    std::vector<uc_iteration_range> ranges(num_workers);
+    for (long id = 0; id < workers; id++)
+    {
+      ranges[id].begin = begin + count * id / workers;
+      ranges[id].end = begin + count * (id + 1) / workers;
+    }
+
+#ifdef UC_THREADED
+    uc_ordered_output output;
+#endif
+    pool.run([&](std::size_t id)
+    {
+      long first, last;
+      while (true)
+      {
+        while (ranges[id].take(chunk, first, last))
+        {
+#ifdef UC_THREADED
+          std::ostringstream buffer;
+          uc_output_buffer = &buffer;
+#endif
+          for (long i = first; i < last; i++)
+          {
+            body(static_cast<UC_PRIMITIVE(int)>(i));
+          }
+#ifdef UC_THREADED
+          uc_output_buffer = nullptr;
+          output.add(first, buffer.str());
+#endif
+        }
+        bool stolen = false;
+        for (std::size_t offset = 1; offset < num_workers && !stolen;
+             offset++)
+        {
+          stolen = ranges[(id + offset) % num_workers].split(first, last);
+        }
+        if (!stolen)
+          return;
+        ranges[id].reset(first, last);
+      }
+    });
+#ifdef UC_THREADED
+    output.write(uc_output());
+#endif
+    return static_cast<UC_PRIMITIVE(int)>(end);
+  }
+
+} // namespace uc
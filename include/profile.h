@@ -0,0 +1,562 @@
+#pragma once
+
+/**
+ * profile.h
+ *
+ * This file provides the runtime support for profiling uC programs
+ * compiled with ucc.py --profile. The generated code defines a
+ * UC_PROFILE_<KIND> macro for each kind of profiling that is enabled,
+ * and the generated main() calls uc_profile_report() when the uC
+ * main() returns.
+ *
+ * Time profiling (UC_PROFILE_TIME) instruments generated functions and
+ * loops with the UC_PROFILE_FUNCTION and UC_PROFILE_LOOP macros.
+ * Reference profiling (UC_PROFILE_REFS) also instruments functions, and
+ * counts the copies, moves and destructions of uC references made
+ * while each function is the innermost one running on a thread.
+ * Allocation profiling (UC_PROFILE_ALLOC) passes a UC_ALLOC_SITE to
+ * each allocation made by a new expression, and the library records
+ * allocations against that site.
+ *
+ * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Functions are instrumented for both time and reference profiling.
+#if defined(UC_PROFILE_TIME) || defined(UC_PROFILE_REFS)
+#define UC_PROFILE_FUNCTIONS
+#endif
+
+#ifdef UC_PROFILE_FUNCTIONS
+// Instrument the enclosing generated function, given its uC name and
+// source line. Must appear at most once in a function.
+#define UC_PROFILE_FUNCTION(name, line)                                 \
+  static uc_profile_site uc_profile_function_site(name, line, false);  \
+  uc_profile_scope uc_profile_function_scope(uc_profile_function_site)
+#endif
+
+#ifdef UC_PROFILE_TIME
+// Count an iteration of a loop, given the uC name of the enclosing
+// function and the source line of the loop.
+#define UC_PROFILE_LOOP(name, line)                                     \
+  {                                                                     \
+    static uc_profile_site uc_profile_loop_site(name, line, true);     \
+    uc_profile_iteration(uc_profile_loop_site);                         \
+  }
+#endif
+
+#ifdef UC_PROFILE_ALLOC
+// A pointer to the allocation site for the given uC type name and
+// source line.
+#define UC_ALLOC_SITE(type, line)                                       \
+  ([]() {                                                               \
+    static uc_alloc_site site(type, line);                              \
+    return &site;                                                       \
+  }())
+#endif
+
+namespace uc {
+
+  // Return the number of rows to print in each table of a report,
+  // given by the UC_PROFILE_TOP environment variable if it is set.
+  inline std::size_t uc_profile_top() {
+    const char *setting = std::getenv("UC_PROFILE_TOP");
+    long top = setting ? std::atol(setting) : 0;
+    return top > 0 ? static_cast<std::size_t>(top) : 20;
+  }
+
+#ifdef UC_PROFILE_FUNCTIONS
+  // A profiled function or loop, identified by the name of its uC
+  // function and its source line.
+  struct uc_profile_site {
+    const char *function;
+    int line;
+    bool is_loop;
+    std::size_t id;
+
+    uc_profile_site(const char *function_in, int line_in, bool is_loop_in);
+  };
+
+  // The counters for a single site in a single thread. For a loop,
+  // calls is the number of iterations.
+  struct uc_profile_counts {
+    long long calls = 0;
+    long long total_ns = 0;
+    long long self_ns = 0;
+    long long ref_copies = 0;
+    long long ref_moves = 0;
+    long long ref_destructions = 0;
+    // number of calls in progress, so that the total time of a
+    // recursive function only includes its outermost calls
+    int active = 0;
+  };
+
+  // The registry of profiled sites and of the counters of each thread.
+  // Counters are kept per thread, so that the instrumentation does not
+  // synchronize in the common case, and are merged when the report is
+  // produced.
+  class uc_profiler {
+    std::mutex lock;
+    std::vector<const uc_profile_site *> sites;
+    std::vector<std::unique_ptr<std::deque<uc_profile_counts>>> threads;
+
+  public:
+    static uc_profiler &instance() {
+      static uc_profiler profiler;
+      return profiler;
+    }
+
+    std::size_t add_site(const uc_profile_site *site) {
+      std::lock_guard<std::mutex> guard(lock);
+      sites.push_back(site);
+      return sites.size() - 1;
+    }
+
+    std::size_t num_sites() {
+      std::lock_guard<std::mutex> guard(lock);
+      return sites.size();
+    }
+
+    // Create the counters for a new thread. They are owned by the
+    // registry, so they outlive the thread.
+    std::deque<uc_profile_counts> *add_thread() {
+      std::lock_guard<std::mutex> guard(lock);
+      threads.emplace_back(new std::deque<uc_profile_counts>());
+      return threads.back().get();
+    }
+
+    // Return the counters of each site, summed over all threads.
+    std::vector<uc_profile_counts> totals() {
+      std::lock_guard<std::mutex> guard(lock);
+      std::vector<uc_profile_counts> result(sites.size());
+      for (auto &counts : threads) {
+        for (std::size_t id = 0; id < counts->size(); id++) {
+          result[id].calls += (*counts)[id].calls;
+          result[id].total_ns += (*counts)[id].total_ns;
+          result[id].self_ns += (*counts)[id].self_ns;
+          result[id].ref_copies += (*counts)[id].ref_copies;
+          result[id].ref_moves += (*counts)[id].ref_moves;
+          result[id].ref_destructions += (*counts)[id].ref_destructions;
+        }
+      }
+      return result;
+    }
+
+    const uc_profile_site &site(std::size_t id) {
+      std::lock_guard<std::mutex> guard(lock);
+      return *sites[id];
+    }
+  };
+
+  inline uc_profile_site::uc_profile_site(const char *function_in,
+                                          int line_in, bool is_loop_in)
+    : function(function_in), line(line_in), is_loop(is_loop_in),
+      id(uc_profiler::instance().add_site(this)) {}
+
+  // Return the counters of the given site for the current thread. The
+  // counters are in a deque, so that references to them remain valid
+  // when sites are added.
+  inline uc_profile_counts &uc_profile_counts_for(const uc_profile_site &site) {
+    static thread_local std::deque<uc_profile_counts> *counts =
+      uc_profiler::instance().add_thread();
+    if (site.id >= counts->size()) {
+      counts->resize(uc_profiler::instance().num_sites());
+    }
+    return (*counts)[site.id];
+  }
+
+  // Count an iteration of the given loop.
+  inline void uc_profile_iteration(const uc_profile_site &site) {
+    uc_profile_counts_for(site).calls++;
+  }
+
+  // Times a call to a function from construction to destruction. The
+  // time spent in instrumented callees on the same thread is
+  // subtracted from the self time of the caller. While the call is the
+  // innermost one on its thread, reference traffic is attributed to
+  // its function.
+  class uc_profile_scope {
+    using clock = std::chrono::steady_clock;
+
+    uc_profile_counts &counts;
+    uc_profile_scope *parent;
+    long long child_ns = 0;
+    clock::time_point start;
+
+    // the innermost call in progress on the current thread
+    static inline thread_local uc_profile_scope *current = nullptr;
+
+  public:
+    explicit uc_profile_scope(const uc_profile_site &site)
+      : counts(uc_profile_counts_for(site)), parent(current) {
+      counts.calls++;
+      counts.active++;
+      current = this;
+#ifdef UC_PROFILE_TIME
+      start = clock::now();
+#endif
+    }
+
+    uc_profile_scope(const uc_profile_scope &) = delete;
+    uc_profile_scope &operator=(const uc_profile_scope &) = delete;
+
+    ~uc_profile_scope() {
+      current = parent;
+      counts.active--;
+#ifdef UC_PROFILE_TIME
+      long long elapsed = std::chrono::duration_cast<
+        std::chrono::nanoseconds>(clock::now() - start).count();
+      if (counts.active == 0) {
+        counts.total_ns += elapsed;
+      }
+      counts.self_ns += elapsed - child_ns;
+      if (parent) {
+        parent->child_ns += elapsed;
+      }
+#endif
+    }
+
+    // Return the counters of the innermost call on the current thread,
+    // or null if there is none.
+    static uc_profile_counts *current_counts() {
+      return current ? &current->counts : nullptr;
+    }
+  };
+#endif
+
+#ifdef UC_PROFILE_TIME
+  // Print the time profile to standard error, with functions sorted
+  // by self time and loops by number of iterations, and write it as
+  // JSON members to json.
+  inline void uc_profile_report_time(std::ostream &json) {
+    uc_profiler &profiler = uc_profiler::instance();
+    std::vector<uc_profile_counts> totals = profiler.totals();
+    std::vector<std::size_t> functions, loops;
+    for (std::size_t id = 0; id < totals.size(); id++) {
+      (profiler.site(id).is_loop ? loops : functions).push_back(id);
+    }
+    std::sort(functions.begin(), functions.end(),
+              [&](std::size_t a, std::size_t b) {
+                return totals[a].self_ns > totals[b].self_ns;
+              });
+    std::sort(loops.begin(), loops.end(),
+              [&](std::size_t a, std::size_t b) {
+                return totals[a].calls > totals[b].calls;
+              });
+
+    std::cerr << std::fixed << std::setprecision(3)
+              << std::setw(24) << std::left << "function"
+              << std::right << std::setw(8) << "line"
+              << std::setw(14) << "calls" << std::setw(14) << "total ms"
+              << std::setw(14) << "self ms" << '\n';
+    for (std::size_t id : functions) {
+      const uc_profile_site &site = profiler.site(id);
+      std::cerr << std::setw(24) << std::left << site.function
+                << std::right << std::setw(8) << site.line
+                << std::setw(14) << totals[id].calls
+                << std::setw(14) << totals[id].total_ns / 1e6
+                << std::setw(14) << totals[id].self_ns / 1e6 << '\n';
+    }
+    std::cerr << '\n' << std::setw(24) << std::left << "loop in"
+              << std::right << std::setw(8) << "line"
+              << std::setw(14) << "iterations" << '\n';
+    for (std::size_t id : loops) {
+      const uc_profile_site &site = profiler.site(id);
+      std::cerr << std::setw(24) << std::left << site.function
+                << std::right << std::setw(8) << site.line
+                << std::setw(14) << totals[id].calls << '\n';
+    }
+    std::cerr << '\n';
+
+    json << "  \"functions\": [";
+    for (std::size_t i = 0; i < functions.size(); i++) {
+      const uc_profile_site &site = profiler.site(functions[i]);
+      const uc_profile_counts &counts = totals[functions[i]];
+      json << (i ? ",\n" : "\n") << "    {\"name\": \"" << site.function
+           << "\", \"line\": " << site.line << ", \"calls\": "
+           << counts.calls << ", \"total_ns\": " << counts.total_ns
+           << ", \"self_ns\": " << counts.self_ns << "}";
+    }
+    json << "\n  ],\n  \"loops\": [";
+    for (std::size_t i = 0; i < loops.size(); i++) {
+      const uc_profile_site &site = profiler.site(loops[i]);
+      json << (i ? ",\n" : "\n") << "    {\"function\": \"" << site.function
+           << "\", \"line\": " << site.line << ", \"iterations\": "
+           << totals[loops[i]].calls << "}";
+    }
+    json << "\n  ]";
+  }
+#endif
+
+#ifdef UC_PROFILE_REFS
+  // Return the counters to which reference traffic on the current
+  // thread is attributed. Traffic outside of any generated function,
+  // such as on the worker threads of a parallel loop, is attributed to
+  // a site of its own.
+  inline uc_profile_counts &uc_profile_ref_counts() {
+    uc_profile_counts *counts = uc_profile_scope::current_counts();
+    if (counts) {
+      return *counts;
+    }
+    static uc_profile_site unattributed("(unattributed)", 0, false);
+    return uc_profile_counts_for(unattributed);
+  }
+
+  // Print the functions with the most reference traffic to standard
+  // error, and write the traffic of each function as JSON members to
+  // json.
+  inline void uc_profile_report_refs(std::ostream &json) {
+    uc_profiler &profiler = uc_profiler::instance();
+    std::vector<uc_profile_counts> totals = profiler.totals();
+    std::vector<std::size_t> functions;
+    for (std::size_t id = 0; id < totals.size(); id++) {
+      if (!profiler.site(id).is_loop) {
+        functions.push_back(id);
+      }
+    }
+    auto traffic = [&](std::size_t id) {
+      return totals[id].ref_copies + totals[id].ref_destructions;
+    };
+    std::sort(functions.begin(), functions.end(),
+              [&](std::size_t a, std::size_t b) {
+                return traffic(a) > traffic(b);
+              });
+    std::size_t top = uc_profile_top();
+
+    std::cerr << std::setw(24) << std::left << "references in"
+              << std::right << std::setw(8) << "line"
+              << std::setw(14) << "calls" << std::setw(14) << "copies"
+              << std::setw(14) << "moves" << std::setw(14)
+              << "destructions" << '\n';
+    for (std::size_t i = 0; i < functions.size() && i < top; i++) {
+      const uc_profile_site &site = profiler.site(functions[i]);
+      const uc_profile_counts &counts = totals[functions[i]];
+      std::cerr << std::setw(24) << std::left << site.function
+                << std::right << std::setw(8) << site.line
+                << std::setw(14) << counts.calls
+                << std::setw(14) << counts.ref_copies
+                << std::setw(14) << counts.ref_moves
+                << std::setw(14) << counts.ref_destructions << '\n';
+    }
+    std::cerr << '\n';
+
+    json << "  \"refs\": [";
+    for (std::size_t i = 0; i < functions.size(); i++) {
+      const uc_profile_site &site = profiler.site(functions[i]);
+      const uc_profile_counts &counts = totals[functions[i]];
+      json << (i ? ",\n" : "\n") << "    {\"function\": \"" << site.function
+           << "\", \"line\": " << site.line << ", \"copies\": "
+           << counts.ref_copies << ", \"moves\": " << counts.ref_moves
+           << ", \"destructions\": " << counts.ref_destructions << "}";
+    }
+    json << "\n  ]";
+  }
+#endif
+
+#ifdef UC_PROFILE_ALLOC
+  // The memory in use by the objects of a single uC type.
+  struct uc_alloc_type {
+    std::string name;
+    std::atomic<long long> live{0};
+    std::atomic<long long> peak{0};
+
+    explicit uc_alloc_type(const std::string &name_in) : name(name_in) {}
+
+    void add(long long bytes) {
+      long long now = live.fetch_add(bytes, std::memory_order_relaxed) +
+        bytes;
+      long long old_peak = peak.load(std::memory_order_relaxed);
+      while (now > old_peak &&
+             !peak.compare_exchange_weak(old_peak, now,
+                                         std::memory_order_relaxed)) {}
+    }
+  };
+
+  // A site in the uC source that allocates objects of some type. The
+  // bytes of a site include those of the buffers of its arrays and
+  // matrices and the slot tables of its maps, and regrowths counts the
+  // times that the buffer of one of its arrays or the table of one of
+  // its maps was reallocated.
+  struct uc_alloc_site {
+    const char *type_name;
+    int line;
+    uc_alloc_type *type;
+    std::atomic<long long> count{0};
+    std::atomic<long long> bytes{0};
+    std::atomic<long long> regrowths{0};
+
+    uc_alloc_site(const char *type_name_in, int line_in);
+  };
+
+  // The registry of allocation sites and of the types they allocate.
+  class uc_alloc_profiler {
+    std::mutex lock;
+    std::vector<uc_alloc_site *> sites;
+    std::map<std::string, std::unique_ptr<uc_alloc_type>> types;
+
+  public:
+    static uc_alloc_profiler &instance() {
+      static uc_alloc_profiler profiler;
+      return profiler;
+    }
+
+    // Register a site, returning the record of the type it allocates.
+    uc_alloc_type *add_site(uc_alloc_site *site) {
+      std::lock_guard<std::mutex> guard(lock);
+      sites.push_back(site);
+      auto &type = types[site->type_name];
+      if (!type) {
+        type.reset(new uc_alloc_type(site->type_name));
+      }
+      return type.get();
+    }
+
+    std::vector<uc_alloc_site *> all_sites() {
+      std::lock_guard<std::mutex> guard(lock);
+      return sites;
+    }
+
+    std::vector<uc_alloc_type *> all_types() {
+      std::lock_guard<std::mutex> guard(lock);
+      std::vector<uc_alloc_type *> result;
+      for (auto &entry : types) {
+        result.push_back(entry.second.get());
+      }
+      return result;
+    }
+  };
+
+  inline uc_alloc_site::uc_alloc_site(const char *type_name_in, int line_in)
+    : type_name(type_name_in), line(line_in),
+      type(uc_alloc_profiler::instance().add_site(this)) {}
+
+  // Return the given site, or the site for allocations made by the
+  // library itself if it is null.
+  inline uc_alloc_site *uc_alloc_site_or_default(uc_alloc_site *site) {
+    static uc_alloc_site runtime_site("(runtime)", 0);
+    return site ? site : &runtime_site;
+  }
+
+  // Record the allocation of an object of the given size.
+  inline void uc_alloc_object(uc_alloc_site *site, std::size_t bytes) {
+    site->count.fetch_add(1, std::memory_order_relaxed);
+    site->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    site->type->add(bytes);
+  }
+
+  // Record the allocation of a buffer of the given size that belongs
+  // to an object.
+  inline void uc_alloc_buffer(uc_alloc_site *site, std::size_t bytes) {
+    site->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    site->type->add(bytes);
+  }
+
+  // Record the reallocation of a buffer from old_bytes to new_bytes.
+  inline void uc_alloc_regrow(uc_alloc_site *site, std::size_t old_bytes,
+                              std::size_t new_bytes) {
+    site->regrowths.fetch_add(1, std::memory_order_relaxed);
+    site->bytes.fetch_add(new_bytes, std::memory_order_relaxed);
+    site->type->add(static_cast<long long>(new_bytes) -
+                    static_cast<long long>(old_bytes));
+  }
+
+  // Record the release of an object or buffer of the given size.
+  inline void uc_alloc_free(uc_alloc_site *site, std::size_t bytes) {
+    site->type->add(-static_cast<long long>(bytes));
+  }
+
+  // Print the top allocation sites by bytes and the top types by peak
+  // bytes to standard error, and write them as JSON members to json.
+  inline void uc_profile_report_alloc(std::ostream &json) {
+    uc_alloc_profiler &profiler = uc_alloc_profiler::instance();
+    std::vector<uc_alloc_site *> sites = profiler.all_sites();
+    std::vector<uc_alloc_type *> types = profiler.all_types();
+    std::sort(sites.begin(), sites.end(),
+              [](uc_alloc_site *a, uc_alloc_site *b) {
+                return a->bytes > b->bytes;
+              });
+    std::sort(types.begin(), types.end(),
+              [](uc_alloc_type *a, uc_alloc_type *b) {
+                return a->peak > b->peak;
+              });
+    std::size_t top = uc_profile_top();
+
+    std::cerr << std::setw(24) << std::left << "allocated type"
+              << std::right << std::setw(8) << "line"
+              << std::setw(14) << "allocations" << std::setw(14) << "bytes"
+              << std::setw(14) << "regrowths" << '\n';
+    for (std::size_t i = 0; i < sites.size() && i < top; i++) {
+      std::cerr << std::setw(24) << std::left << sites[i]->type_name
+                << std::right << std::setw(8) << sites[i]->line
+                << std::setw(14) << sites[i]->count
+                << std::setw(14) << sites[i]->bytes
+                << std::setw(14) << sites[i]->regrowths << '\n';
+    }
+    std::cerr << '\n' << std::setw(24) << std::left << "type"
+              << std::right << std::setw(8) << ""
+              << std::setw(14) << "live bytes" << std::setw(14)
+              << "peak bytes" << '\n';
+    for (std::size_t i = 0; i < types.size() && i < top; i++) {
+      std::cerr << std::setw(24) << std::left << types[i]->name
+                << std::right << std::setw(8) << ""
+                << std::setw(14) << types[i]->live
+                << std::setw(14) << types[i]->peak << '\n';
+    }
+    std::cerr << '\n';
+
+    json << "  \"alloc_sites\": [";
+    for (std::size_t i = 0; i < sites.size(); i++) {
+      json << (i ? ",\n" : "\n") << "    {\"type\": \""
+           << sites[i]->type_name << "\", \"line\": " << sites[i]->line
+           << ", \"allocations\": " << sites[i]->count
+           << ", \"bytes\": " << sites[i]->bytes
+           << ", \"regrowths\": " << sites[i]->regrowths << "}";
+    }
+    json << "\n  ],\n  \"alloc_types\": [";
+    for (std::size_t i = 0; i < types.size(); i++) {
+      json << (i ? ",\n" : "\n") << "    {\"type\": \"" << types[i]->name
+           << "\", \"live_bytes\": " << types[i]->live
+           << ", \"peak_bytes\": " << types[i]->peak << "}";
+    }
+    json << "\n  ]";
+  }
+#endif
+
+  // Print a profile of the program to standard error, and write the
+  // same data as JSON to <program>.profile.json.
+  inline void uc_profile_report(const std::string &program) {
+    std::cout.flush();
+    std::ofstream json(program + ".profile.json");
+    const char *separator = "{\n";
+#ifdef UC_PROFILE_TIME
+    json << separator;
+    uc_profile_report_time(json);
+    separator = ",\n";
+#endif
+#ifdef UC_PROFILE_ALLOC
+    json << separator;
+    uc_profile_report_alloc(json);
+    separator = ",\n";
+#endif
+#ifdef UC_PROFILE_REFS
+    json << separator;
+    uc_profile_report_refs(json);
+    separator = ",\n";
+#endif
+    json << "\n}\n";
+  }
+
+} // namespace uc
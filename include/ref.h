@@ -9,30 +9,183 @@
  * Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
  */
 
-#include <memory>
+#include <atomic>
+#include <cstddef>
+#include <utility>
 #include "defs.h"
 
+#if defined(UC_PROFILE_ALLOC) || defined(UC_PROFILE_REFS)
+#include "profile.h"
+#endif
+
 namespace uc {
 
-  // The class type representing a uC reference. It is built on top of
-  // std::shared_ptr, which performs reference counting. The latter is
-  // not used directly, since operations such as == are defined
+  // A site in the uC source that allocates objects, which is only
+  // defined when allocations are profiled. Functions that allocate
+  // take a pointer to their site, which is null for an allocation made
+  // by the library itself.
+  struct uc_alloc_site;
+
+#ifdef UC_PROFILE_ALLOC
+  // Record the allocation of the buffers that belong to an object at
+  // the given site. Objects without buffers of their own have nothing
+  // to record.
+  template<class T>
+  void uc_alloc_attach(T &, uc_alloc_site *) {}
+#endif
+
+  // The reference count of a uC object. A program that uses parallel
+  // constructs is compiled with UC_THREADED defined, in which case the
+  // count is atomic, since objects may be shared between threads.
+  // Otherwise, the count is a plain integer, so that a serial program
+  // does not pay for synchronization.
+#ifdef UC_THREADED
+  using uc_count = std::atomic<long>;
+#else
+  using uc_count = long;
+#endif
+
+  // Increment a reference count.
+  inline void uc_count_increment(uc_count &count) {
+#ifdef UC_THREADED
+    count.fetch_add(1, std::memory_order_relaxed);
+#else
+    ++count;
+#endif
+  }
+
+  // Decrement a reference count, returning whether it dropped to zero.
+  inline bool uc_count_decrement(uc_count &count) {
+#ifdef UC_THREADED
+    return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+#else
+    return --count == 0;
+#endif
+  }
+
+  // The reference count of a uC object. The destructor is virtual, so
+  // that a reference can release an object whose type is incomplete
+  // where the reference is destroyed.
+  struct uc_counted_base {
+    uc_count count;
+#ifdef UC_PROFILE_ALLOC
+    uc_alloc_site *alloc_site = nullptr;
+    std::size_t alloc_bytes = 0;
+#endif
+
+    uc_counted_base() : count(1) {}
+    virtual ~uc_counted_base() {}
+  };
+
+  // A uC object together with its reference count, allocated as a
+  // single block.
+  template<class T>
+  struct uc_counted : uc_counted_base {
+    T object;
+
+    template<class... Args>
+    explicit uc_counted(Args&&... args)
+      : object(std::forward<Args>(args)...) {}
+  };
+
+  // The class type representing a uC reference, which performs
+  // reference counting. std::shared_ptr is not used, since it always
+  // uses atomic counts, and since operations such as == are defined
   // differently in uC than they are in C++.
   template<class T>
-  struct uc_reference : std::shared_ptr<T> {
+  class uc_reference {
+    uc_counted_base *block = nullptr;
+
+    explicit uc_reference(uc_counted_base *block_in) : block(block_in) {}
+
+  public:
+    using element_type = T;
+
     uc_reference() {}
-    uc_reference(std::nullptr_t n) : std::shared_ptr<T>(n) {}
-    template<class Y>
-    explicit uc_reference(Y *ptr) : std::shared_ptr<T>(ptr) {}
-    uc_reference(const std::shared_ptr<T> &sp) : std::shared_ptr<T>(sp) {}
-    uc_reference(std::shared_ptr<T> &&sp) : std::shared_ptr<T>(sp) {}
+    uc_reference(std::nullptr_t) {}
+
+    uc_reference(const uc_reference &other) : block(other.block) {
+      if (block) {
+#ifdef UC_PROFILE_REFS
+        uc_profile_ref_counts().ref_copies++;
+#endif
+        uc_count_increment(block->count);
+      }
+    }
+
+    uc_reference(uc_reference &&other) : block(other.block) {
+#ifdef UC_PROFILE_REFS
+      if (block) {
+        uc_profile_ref_counts().ref_moves++;
+      }
+#endif
+      other.block = nullptr;
+    }
+
+    uc_reference &operator=(uc_reference other) {
+      std::swap(block, other.block);
+      return *this;
+    }
+
+    ~uc_reference() {
+#ifdef UC_PROFILE_REFS
+      if (block) {
+        uc_profile_ref_counts().ref_destructions++;
+      }
+#endif
+      if (block && uc_count_decrement(block->count)) {
+#ifdef UC_PROFILE_ALLOC
+        uc_alloc_free(block->alloc_site, block->alloc_bytes);
+#endif
+        delete block;
+      }
+    }
+
+    // Construct a uC object from the given arguments at the given
+    // allocation site, returning a reference to it.
+    template<class... Args>
+    static uc_reference make_at(uc_alloc_site *site, Args&&... args) {
+      auto counted = new uc_counted<T>(std::forward<Args>(args)...);
+#ifdef UC_PROFILE_ALLOC
+      counted->alloc_site = uc_alloc_site_or_default(site);
+      counted->alloc_bytes = sizeof(*counted);
+      uc_alloc_object(counted->alloc_site, counted->alloc_bytes);
+      uc_alloc_attach(counted->object, counted->alloc_site);
+#else
+      static_cast<void>(site);
+#endif
+      return uc_reference(counted);
+    }
+
+    T *get() const {
+      return block ? &static_cast<uc_counted<T> *>(block)->object : nullptr;
+    }
+
+    T &operator*() const {
+      return static_cast<uc_counted<T> *>(block)->object;
+    }
+
+    T *operator->() const {
+      return &static_cast<uc_counted<T> *>(block)->object;
+    }
+
+    explicit operator bool() const {
+      return block != nullptr;
+    }
   };
 
+  // A function template to construct a uC object at the given
+  // allocation site and wrap it in a uC reference.
+  template<class T, class... Args>
+  T uc_make_object_at(uc_alloc_site *site, Args&&... args) {
+    return T::make_at(site, std::forward<Args>(args)...);
+  }
+
   // A function template to construct a uC object and wrap it in a uC
   // reference.
   template<class T, class... Args>
   T uc_make_object(Args&&... args) {
-    return T(std::make_shared<typename T::element_type>(args...));
+    return T::make_at(nullptr, std::forward<Args>(args)...);
   }
 
   // Comparisons between two uC references. Two uC references are
@@ -56,22 +209,44 @@ namespace uc {
   // Comparisons between uC references and null-pointer literals.
   template<class T>
   bool operator==(const uc_reference<T> &p, std::nullptr_t) {
-    return static_cast<const std::shared_ptr<T> &>(p) == nullptr;
+    return p.get() == nullptr;
   }
 
   template<class T>
   bool operator==(std::nullptr_t, const uc_reference<T> &p) {
-    return static_cast<const std::shared_ptr<T> &>(p) == nullptr;
+    return p.get() == nullptr;
   }
 
   template<class T>
   bool operator!=(const uc_reference<T> &p, std::nullptr_t) {
-    return static_cast<const std::shared_ptr<T> &>(p) != nullptr;
+    return p.get() != nullptr;
   }
 
   template<class T>
   bool operator!=(std::nullptr_t, const uc_reference<T> &p) {
-    return static_cast<const std::shared_ptr<T> &>(p) != nullptr;
+    return p.get() != nullptr;
+  }
+
+  // Hash of a uC reference, used by the map built-in type. Consistent
+  // with ==, a reference hashes the contents of the object it refers
+  // to, through the object's uc_hash() member function.
+  template<class T>
+  std::size_t uc_hash(const uc_reference<T> &p) {
+    return p == nullptr ? 0 : p->uc_hash();
+  }
+
+  // Ordering between two uC references, used by the sort() and
+  // binary_search() built-ins. A null reference is ordered before any
+  // object, and objects are ordered by their generated uc_less()
+  // member function.
+  template<class T>
+  bool uc_less(const uc_reference<T> &p1, const uc_reference<T> &p2) {
+    if (p2 == nullptr) {
+      return false;
+    } else if (p1 == nullptr) {
+      return true;
+    }
+    return p1->uc_less(*p2);
   }
 
 } // namespace uc
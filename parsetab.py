@@ -5,9 +5,9 @@ _tabversion = '3.8'
 
 _lr_method = 'LALR'
 
-_lr_signature = 'EB0F0F907505CDDB7D32C9EF6DC2C807'
+_lr_signature = '736098EAD0884452F53633021B9ABDD1'
     
-_lr_action_items = {'STRUCT':([0,2,3,4,5,6,35,39,89,],[-100,9,-3,-2,-4,-5,-6,-20,-21,]),'IDENT':([0,2,3,4,5,6,7,8,9,10,14,15,16,17,26,29,31,33,35,39,40,42,44,45,46,47,48,49,50,51,53,59,76,77,78,79,80,81,82,89,90,91,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[-100,10,-3,-2,-4,-5,10,-12,10,-14,10,-13,10,10,10,10,10,10,-6,-20,10,10,-24,-26,-27,-28,-29,-30,-31,-32,10,10,10,10,10,10,10,10,10,-21,-25,10,-43,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,-39,-40,-42,10,-41,10,10,10,10,-100,-37,-33,-36,10,-34,-35,-38,]),'$end':([0,1,2,3,4,5,6,35,39,89,],[-100,0,-1,-3,-2,-4,-5,-6,-20,-21,]),'LBRACKET':([7,8,10,15,17,26,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[12,-12,-14,-13,12,12,95,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,95,95,-12,12,95,95,95,95,95,95,95,-68,-76,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,-77,-69,95,-74,-75,]),'LPAREN':([10,11,13,28,40,42,44,45,46,47,48,49,50,51,52,53,55,56,59,75,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,119,151,156,157,161,163,166,167,172,174,175,176,177,180,],[-14,14,16,33,53,53,-24,-26,-27,-28,-29,-30,-31,-32,91,53,112,113,53,118,53,53,53,53,53,53,-21,-25,53,-43,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,-39,-40,-42,53,156,-41,53,53,53,53,-100,-37,-33,-36,53,-34,-35,-38,]),'COMMA':([10,19,21,23,25,27,32,34,36,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,121,122,123,124,125,126,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,153,155,159,162,169,170,171,],[-14,29,-17,31,-9,-19,-11,-18,-10,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,-78,-79,-80,-81,-82,-83,-68,-76,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,163,-72,-77,-69,-73,-74,-75,]),'RPAREN':([10,14,16,18,19,20,21,22,23,24,25,27,32,33,34,36,37,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,118,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,150,152,153,154,155,156,159,162,164,169,170,171,175,178,],[-14,-100,-100,28,-15,-16,-17,30,-7,-8,-9,-19,-11,-100,-18,-10,38,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,128,-100,-78,-79,-80,-81,-82,-83,158,-68,-76,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,160,-54,-55,162,-70,-71,-72,-100,-77,-69,170,-73,-74,-75,-100,179,]),'SEMI':([10,30,54,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,113,116,121,122,123,124,125,126,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,148,149,150,159,161,162,168,170,171,],[-14,35,93,114,115,117,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,-100,151,-78,-79,-80,-81,-82,-83,-68,-76,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,161,-54,-55,-77,-100,-69,175,-74,-75,]),'PERIOD':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,94,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,94,94,94,94,94,94,94,94,94,-68,-76,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,-77,-69,94,-74,-75,]),'PLUS':([10,40,42,44,45,46,47,48,49,50,51,53,54,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,151,155,156,157,159,161,162,163,166,167,169,170,171,172,174,175,176,177,180,],[-14,77,77,-24,-26,-27,-28,-29,-30,-31,-32,77,96,77,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,77,77,77,77,77,77,-61,-62,-63,-64,-65,-66,-21,-25,77,96,-43,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,-39,-40,96,-42,77,-78,-79,-80,-81,-82,-83,96,-68,-76,96,-84,-85,-86,-87,-88,96,96,96,96,96,96,96,96,96,96,96,96,96,-41,96,77,77,-77,77,-69,77,-100,-37,96,-74,-75,-33,-36,77,-34,-35,-38,]),'MINUS':([10,40,42,44,45,46,47,48,49,50,51,53,54,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,151,155,156,157,159,161,162,163,166,167,169,170,171,172,174,175,176,177,180,],[-14,78,78,-24,-26,-27,-28,-29,-30,-31,-32,78,97,78,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,78,78,78,78,78,78,-61,-62,-63,-64,-65,-66,-21,-25,78,97,-43,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,-39,-40,97,-42,78,-78,-79,-80,-81,-82,-83,97,-68,-76,97,-84,-85,-86,-87,-88,97,97,97,97,97,97,97,97,97,97,97,97,97,-41,97,78,78,-77,78,-69,78,-100,-37,97,-74,-75,-33,-36,78,-34,-35,-38,]),'TIMES':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,98,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,98,98,-78,-79,-80,-81,-82,-83,98,-68,-76,98,98,98,-86,-87,-88,98,98,98,98,98,98,98,98,98,98,98,98,98,98,-77,-69,98,-74,-75,]),'DIVIDE':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,99,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,99,99,-78,-79,-80,-81,-82,-83,99,-68,-76,99,99,99,-86,-87,-88,99,99,99,99,99,99,99,99,99,99,99,99,99,99,-77,-69,99,-74,-75,]),'MODULO':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,100,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,100,100,-78,-79,-80,-81,-82,-83,100,-68,-76,100,100,100,-86,-87,-88,100,100,100,100,100,100,100,100,100,100,100,100,100,100,-77,-69,100,-74,-75,]),'LOR':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,101,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,101,101,-78,-79,-80,-81,-82,-83,101,-68,-76,101,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,101,101,101,101,101,101,-77,-69,101,-74,-75,]),'LAND':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,102,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,102,102,-78,-79,-80,-81,-82,-83,102,-68,-76,102,-84,-85,-86,-87,-88,102,-90,-91,-92,-93,-94,-95,-96,102,102,102,102,102,102,-77,-69,102,-74,-75,]),'LT':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,103,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,103,103,-78,-79,-80,-81,-82,-83,103,-68,-76,103,-84,-85,-86,-87,-88,103,103,None,None,None,None,103,103,103,103,103,103,103,103,-77,-69,103,-74,-75,]),'LE':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,104,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,104,104,-78,-79,-80,-81,-82,-83,104,-68,-76,104,-84,-85,-86,-87,-88,104,104,None,None,None,None,104,104,104,104,104,104,104,104,-77,-69,104,-74,-75,]),'GT':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,105,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,105,105,-78,-79,-80,-81,-82,-83,105,-68,-76,105,-84,-85,-86,-87,-88,105,105,None,None,None,None,105,105,105,105,105,105,105,105,-77,-69,105,-74,-75,]),'GE':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,106,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,106,106,-78,-79,-80,-81,-82,-83,106,-68,-76,106,-84,-85,-86,-87,-88,106,106,None,None,None,None,106,106,106,106,106,106,106,106,-77,-69,106,-74,-75,]),'EQ':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,107,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,107,107,-78,-79,-80,-81,-82,-83,107,-68,-76,107,-84,-85,-86,-87,-88,107,107,-91,-92,-93,-94,None,None,107,107,107,107,107,107,-77,-69,107,-74,-75,]),'NE':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,108,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,108,108,-78,-79,-80,-81,-82,-83,108,-68,-76,108,-84,-85,-86,-87,-88,108,108,-91,-92,-93,-94,None,None,108,108,108,108,108,108,-77,-69,108,-74,-75,]),'EQUALS':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,109,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,109,109,-78,-79,-80,-81,-82,-83,109,-68,-76,109,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,109,109,109,109,109,109,-77,-69,109,-74,-75,]),'PUSH':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,110,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,110,110,-78,-79,-80,-81,-82,-83,110,-68,-76,110,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,110,110,110,-77,-69,110,-74,-75,]),'POP':([10,54,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,92,116,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,159,162,169,170,171,],[-14,111,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,111,111,-78,-79,-80,-81,-82,-83,111,-68,-76,111,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,111,111,111,-77,-69,111,-74,-75,]),'LBRACE':([10,15,38,119,120,158,160,173,179,],[-14,-13,40,-12,157,40,40,40,40,]),'RBRACKET':([10,12,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,121,122,123,124,125,126,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,159,162,170,171,],[-14,15,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,-78,-79,-80,-81,-82,-83,-68,-76,159,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,-77,-69,-74,-75,]),'RBRACE':([10,40,41,42,43,44,45,46,47,48,49,50,51,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,83,84,85,86,87,88,89,90,93,114,115,117,121,122,123,124,125,126,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,151,153,154,155,157,159,162,165,166,167,169,170,171,172,174,176,177,180,],[-14,-100,89,-22,-23,-24,-26,-27,-28,-29,-30,-31,-32,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-56,-57,-58,-59,-60,-67,-61,-62,-63,-64,-65,-66,-21,-25,-43,-39,-40,-42,-78,-79,-80,-81,-82,-83,-68,-76,-84,-85,-86,-87,-88,-89,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,-41,-70,-71,-72,-100,-77,-69,171,-100,-37,-73,-74,-75,-33,-36,-34,-35,-38,]),'IF':([40,42,44,45,46,47,48,49,50,51,89,90,93,114,115,117,151,166,167,172,173,174,176,177,180,],[52,52,-24,-26,-27,-28,-29,-30,-31,-32,-21,-25,-43,-39,-40,-42,-41,-100,-37,-33,52,-36,-34,-35,-38,]),'WHILE':([40,42,44,45,46,47,48,49,50,51,89,90,93,114,115,117,151,166,167,172,174,176,177,180,],[55,55,-24,-26,-27,-28,-29,-30,-31,-32,-21,-25,-43,-39,-40,-42,-41,-100,-37,-33,-36,-34,-35,-38,]),'FOR':([40,42,44,45,46,47,48,49,50,51,89,90,93,114,115,117,151,166,167,172,174,176,177,180,],[56,56,-24,-26,-27,-28,-29,-30,-31,-32,-21,-25,-43,-39,-40,-42,-41,-100,-37,-33,-36,-34,-35,-38,]),'BREAK':([40,42,44,45,46,47,48,49,50,51,89,90,93,114,115,117,151,166,167,172,174,176,177,180,],[57,57,-24,-26,-27,-28,-29,-30,-31,-32,-21,-25,-43,-39,-40,-42,-41,-100,-37,-33,-36,-34,-35,-38,]),'CONTINUE':([40,42,44,45,46,47,48,49,50,51,89,90,93,114,115,117,151,166,167,172,174,176,177,180,],[58,58,-24,-26,-27,-28,-29,-30,-31,-32,-21,-25,-43,-39,-40,-42,-41,-100,-37,-33,-36,-34,-35,-38,]),'RETURN':([40,42,44,45,46,47,48,49,50,51,89,90,93,114,115,117,151,166,167,172,174,176,177,180,],[59,59,-24,-26,-27,-28,-29,-30,-31,-32,-21,-25,-43,-39,-40,-42,-41,-100,-37,-33,-36,-34,-35,-38,]),'NEW':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[76,76,-24,-26,-27,-28,-29,-30,-31,-32,76,76,76,76,76,76,76,76,-21,-25,76,-43,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,-39,-40,-42,76,-41,76,76,76,76,-100,-37,-33,-36,76,-34,-35,-38,]),'LNOT':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[79,79,-24,-26,-27,-28,-29,-30,-31,-32,79,79,79,79,79,79,79,79,-21,-25,79,-43,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,-39,-40,-42,79,-41,79,79,79,79,-100,-37,-33,-36,79,-34,-35,-38,]),'INCREMENT':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[80,80,-24,-26,-27,-28,-29,-30,-31,-32,80,80,80,80,80,80,80,80,-21,-25,80,-43,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,-39,-40,-42,80,-41,80,80,80,80,-100,-37,-33,-36,80,-34,-35,-38,]),'DECREMENT':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[81,81,-24,-26,-27,-28,-29,-30,-31,-32,81,81,81,81,81,81,81,81,-21,-25,81,-43,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,-39,-40,-42,81,-41,81,81,81,81,-100,-37,-33,-36,81,-34,-35,-38,]),'ID':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[82,82,-24,-26,-27,-28,-29,-30,-31,-32,82,82,82,82,82,82,82,82,-21,-25,82,-43,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,-39,-40,-42,82,-41,82,82,82,82,-100,-37,-33,-36,82,-34,-35,-38,]),'INTEGER':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[83,83,-24,-26,-27,-28,-29,-30,-31,-32,83,83,83,83,83,83,83,83,-21,-25,83,-43,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,-39,-40,-42,83,-41,83,83,83,83,-100,-37,-33,-36,83,-34,-35,-38,]),'FLOAT':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[84,84,-24,-26,-27,-28,-29,-30,-31,-32,84,84,84,84,84,84,84,84,-21,-25,84,-43,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,-39,-40,-42,84,-41,84,84,84,84,-100,-37,-33,-36,84,-34,-35,-38,]),'STRING':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[85,85,-24,-26,-27,-28,-29,-30,-31,-32,85,85,85,85,85,85,85,85,-21,-25,85,-43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,-39,-40,-42,85,-41,85,85,85,85,-100,-37,-33,-36,85,-34,-35,-38,]),'TRUE':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[86,86,-24,-26,-27,-28,-29,-30,-31,-32,86,86,86,86,86,86,86,86,-21,-25,86,-43,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,-39,-40,-42,86,-41,86,86,86,86,-100,-37,-33,-36,86,-34,-35,-38,]),'FALSE':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[87,87,-24,-26,-27,-28,-29,-30,-31,-32,87,87,87,87,87,87,87,87,-21,-25,87,-43,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,-39,-40,-42,87,-41,87,87,87,87,-100,-37,-33,-36,87,-34,-35,-38,]),'NULL':([40,42,44,45,46,47,48,49,50,51,53,59,77,78,79,80,81,82,89,90,91,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,117,118,151,156,157,161,163,166,167,172,174,175,176,177,180,],[88,88,-24,-26,-27,-28,-29,-30,-31,-32,88,88,88,88,88,88,88,88,-21,-25,88,-43,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,-39,-40,-42,88,-41,88,88,88,88,-100,-37,-33,-36,88,-34,-35,-38,]),'ELSE':([89,166,],[-21,173,]),}
+_lr_action_items = {'STRUCT':([0,2,3,4,5,6,8,11,49,52,54,104,],[-109,9,-3,-2,-4,-5,14,-18,-6,-7,-24,-25,]),'IDENT':([0,2,3,4,5,6,7,8,9,10,11,14,15,17,18,21,23,24,29,30,31,36,39,43,45,48,49,52,54,55,57,59,60,61,62,63,64,65,66,68,75,91,92,93,94,95,96,97,104,105,106,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[-109,11,-3,-2,-4,-5,11,-13,11,-16,-18,11,11,11,-14,-13,11,11,-15,11,11,11,11,11,11,-17,-6,-7,-24,11,11,-28,-30,-31,-32,-33,-34,-35,-36,11,11,11,11,11,11,11,11,11,-25,-29,11,-48,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,-44,-45,-47,11,-46,11,11,11,11,11,11,-109,-41,11,11,-37,-40,11,-38,-39,11,-42,-43,]),'$end':([0,1,2,3,4,5,6,49,52,54,104,],[-109,0,-1,-3,-2,-4,-5,-6,-7,-24,-25,]),'LBRACKET':([7,8,10,11,18,21,22,24,29,36,41,48,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[13,-13,-16,-18,-14,-13,13,13,-15,13,13,-17,111,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,111,-72,111,-13,-16,178,111,111,111,111,111,111,111,-73,-84,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,-85,-74,-80,111,111,111,-79,-81,-82,-86,111,-83,]),'LT':([8,11,21,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,136,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[15,-18,15,119,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,119,-72,119,15,-87,-88,-89,-90,-91,-92,119,-73,-84,119,-93,-94,-95,-96,-97,119,119,None,None,None,None,119,119,119,119,119,119,119,119,-85,-74,-80,119,119,119,-79,-81,-82,-86,119,-83,]),'COMMA':([10,11,13,18,21,22,26,28,29,33,35,37,44,46,48,50,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,108,139,140,141,142,143,144,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,171,173,178,180,185,188,190,196,197,198,199,204,212,],[-16,-18,19,-14,-13,31,39,-21,-15,43,-10,-23,-12,-22,-17,-11,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,-72,-87,-88,-89,-90,-91,-92,-73,-84,181,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,186,-77,19,-85,-74,-80,200,-78,-79,-81,-82,-86,-83,]),'GT':([10,11,18,21,29,41,48,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-16,-18,-14,-13,-15,48,-17,121,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,121,-72,121,-87,-88,-89,-90,-91,-92,121,-73,-84,121,-93,-94,-95,-96,-97,121,121,None,None,None,None,121,121,121,121,121,121,121,121,-85,-74,-80,121,121,121,-79,-81,-82,-86,121,-83,]),'LPAREN':([11,12,16,20,38,48,55,57,59,60,61,62,63,64,65,66,67,68,70,71,72,75,92,93,94,95,96,97,104,105,106,108,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,135,136,137,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[-18,17,23,30,45,-17,68,68,-28,-30,-31,-32,-33,-34,-35,-36,106,68,128,129,131,68,68,68,68,68,68,68,-25,-29,68,131,-48,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,169,68,-44,-45,-47,175,176,68,-46,68,68,68,68,68,68,-109,-41,68,68,-37,-40,68,-38,-39,68,-42,-43,]),'RPAREN':([11,17,23,25,26,27,28,30,32,33,34,35,37,40,44,45,46,50,51,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,131,139,140,141,142,143,144,145,146,147,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,168,170,171,172,173,175,176,180,185,187,188,196,197,198,199,204,205,210,211,212,214,],[-18,-109,-109,38,-19,-20,-21,-109,42,-8,-9,-10,-23,47,-12,-109,-22,-11,53,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,146,-72,-109,-87,-88,-89,-90,-91,-92,179,-73,-84,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,182,-59,-60,185,-75,-76,-77,-109,188,-85,-74,197,-80,-78,-79,-81,-82,-86,-109,213,-109,-83,216,]),'FOR':([11,55,57,59,60,61,62,63,64,65,66,72,104,105,109,132,133,135,174,191,193,201,203,208,209,215,217,],[-18,71,71,-28,-30,-31,-32,-33,-34,-35,-36,130,-25,-29,-48,-44,-45,-47,-46,-109,-41,-37,-40,-38,-39,-42,-43,]),'SEMI':([11,42,47,69,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,108,129,134,139,140,141,142,143,144,146,147,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,166,167,168,169,180,183,184,185,188,194,195,197,198,199,204,206,212,],[-18,49,52,109,-72,132,133,135,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,-72,-109,174,-87,-88,-89,-90,-91,-92,-73,-84,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,183,-59,-60,-109,-85,-109,195,-74,-80,205,-109,-79,-81,-82,-86,211,-83,]),'PERIOD':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,110,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,110,-72,110,110,110,110,110,110,110,110,-73,-84,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,-85,-74,-80,110,110,110,-79,-81,-82,-86,110,-83,]),'PLUS':([11,55,57,59,60,61,62,63,64,65,66,68,69,72,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,169,173,174,175,177,178,180,181,183,185,186,188,190,191,192,193,195,196,197,198,199,200,201,203,204,205,207,208,209,211,212,215,217,],[-18,92,92,-28,-30,-31,-32,-33,-34,-35,-36,92,112,-72,92,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,92,92,92,92,92,92,-66,-67,-68,-69,-70,-71,-25,-29,92,112,-72,-48,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,-44,-45,112,-47,-87,-88,-89,-90,-91,-92,112,-73,-84,112,-93,-94,-95,-96,-97,112,112,112,112,112,112,112,112,112,112,112,112,112,92,112,-46,92,92,92,-85,92,92,-74,92,-80,112,-109,112,-41,92,112,-79,-81,-82,92,-37,-40,-86,92,112,-38,-39,92,-83,-42,-43,]),'MINUS':([11,55,57,59,60,61,62,63,64,65,66,68,69,72,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,169,173,174,175,177,178,180,181,183,185,186,188,190,191,192,193,195,196,197,198,199,200,201,203,204,205,207,208,209,211,212,215,217,],[-18,93,93,-28,-30,-31,-32,-33,-34,-35,-36,93,113,-72,93,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,93,93,93,93,93,93,-66,-67,-68,-69,-70,-71,-25,-29,93,113,-72,-48,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,-44,-45,113,-47,-87,-88,-89,-90,-91,-92,113,-73,-84,113,-93,-94,-95,-96,-97,113,113,113,113,113,113,113,113,113,113,113,113,113,93,113,-46,93,93,93,-85,93,93,-74,93,-80,113,-109,113,-41,93,113,-79,-81,-82,93,-37,-40,-86,93,113,-38,-39,93,-83,-42,-43,]),'TIMES':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,114,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,114,-72,114,-87,-88,-89,-90,-91,-92,114,-73,-84,114,114,114,-95,-96,-97,114,114,114,114,114,114,114,114,114,114,114,114,114,114,-85,-74,-80,114,114,114,-79,-81,-82,-86,114,-83,]),'DIVIDE':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,115,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,115,-72,115,-87,-88,-89,-90,-91,-92,115,-73,-84,115,115,115,-95,-96,-97,115,115,115,115,115,115,115,115,115,115,115,115,115,115,-85,-74,-80,115,115,115,-79,-81,-82,-86,115,-83,]),'MODULO':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,116,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,116,-72,116,-87,-88,-89,-90,-91,-92,116,-73,-84,116,116,116,-95,-96,-97,116,116,116,116,116,116,116,116,116,116,116,116,116,116,-85,-74,-80,116,116,116,-79,-81,-82,-86,116,-83,]),'LOR':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,117,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,117,-72,117,-87,-88,-89,-90,-91,-92,117,-73,-84,117,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,117,117,117,117,117,117,-85,-74,-80,117,117,117,-79,-81,-82,-86,117,-83,]),'LAND':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,118,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,118,-72,118,-87,-88,-89,-90,-91,-92,118,-73,-84,118,-93,-94,-95,-96,-97,118,-99,-100,-101,-102,-103,-104,-105,118,118,118,118,118,118,-85,-74,-80,118,118,118,-79,-81,-82,-86,118,-83,]),'LE':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,120,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,120,-72,120,-87,-88,-89,-90,-91,-92,120,-73,-84,120,-93,-94,-95,-96,-97,120,120,None,None,None,None,120,120,120,120,120,120,120,120,-85,-74,-80,120,120,120,-79,-81,-82,-86,120,-83,]),'GE':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,122,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,122,-72,122,-87,-88,-89,-90,-91,-92,122,-73,-84,122,-93,-94,-95,-96,-97,122,122,None,None,None,None,122,122,122,122,122,122,122,122,-85,-74,-80,122,122,122,-79,-81,-82,-86,122,-83,]),'EQ':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,123,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,123,-72,123,-87,-88,-89,-90,-91,-92,123,-73,-84,123,-93,-94,-95,-96,-97,123,123,-100,-101,-102,-103,None,None,123,123,123,123,123,123,-85,-74,-80,123,123,123,-79,-81,-82,-86,123,-83,]),'NE':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,124,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,124,-72,124,-87,-88,-89,-90,-91,-92,124,-73,-84,124,-93,-94,-95,-96,-97,124,124,-100,-101,-102,-103,None,None,124,124,124,124,124,124,-85,-74,-80,124,124,124,-79,-81,-82,-86,124,-83,]),'EQUALS':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,125,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,125,-72,125,-87,-88,-89,-90,-91,-92,125,-73,-84,125,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,125,125,125,125,125,125,-85,-74,-80,125,125,125,-79,-81,-82,-86,125,-83,]),'PUSH':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,126,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,126,-72,126,-87,-88,-89,-90,-91,-92,126,-73,-84,126,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,126,126,126,-85,-74,-80,126,126,126,-79,-81,-82,-86,126,-83,]),'POP':([11,69,72,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,107,108,134,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,180,185,188,190,192,196,197,198,199,204,207,212,],[-18,127,-72,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,127,-72,127,-87,-88,-89,-90,-91,-92,127,-73,-84,127,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,127,127,127,-85,-74,-80,127,127,127,-79,-81,-82,-86,127,-83,]),'LBRACE':([11,18,29,48,53,136,137,138,179,182,202,213,216,],[-18,-14,-15,-17,55,-13,-16,177,55,55,55,55,55,]),'RBRACKET':([11,13,19,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,108,139,140,141,142,143,144,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,178,180,185,188,190,192,197,198,199,204,207,212,],[-18,18,29,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,-72,-87,-88,-89,-90,-91,-92,-73,-84,180,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,18,-85,-74,-80,199,204,-79,-81,-82,-86,212,-83,]),'RBRACE':([11,55,56,57,58,59,60,61,62,63,64,65,66,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,98,99,100,101,102,103,104,105,108,109,132,133,135,139,140,141,142,143,144,146,147,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,171,172,173,174,177,180,185,188,189,191,193,196,197,198,199,201,203,204,208,209,212,215,217,],[-18,-109,104,-26,-27,-28,-30,-31,-32,-33,-34,-35,-36,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-71,-25,-29,-72,-48,-44,-45,-47,-87,-88,-89,-90,-91,-92,-73,-84,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-75,-76,-77,-46,-109,-85,-74,-80,198,-109,-41,-78,-79,-81,-82,-37,-40,-86,-38,-39,-83,-42,-43,]),'IF':([55,57,59,60,61,62,63,64,65,66,104,105,109,132,133,135,174,191,193,201,202,203,208,209,215,217,],[67,67,-28,-30,-31,-32,-33,-34,-35,-36,-25,-29,-48,-44,-45,-47,-46,-109,-41,-37,67,-40,-38,-39,-42,-43,]),'WHILE':([55,57,59,60,61,62,63,64,65,66,104,105,109,132,133,135,174,191,193,201,203,208,209,215,217,],[70,70,-28,-30,-31,-32,-33,-34,-35,-36,-25,-29,-48,-44,-45,-47,-46,-109,-41,-37,-40,-38,-39,-42,-43,]),'BREAK':([55,57,59,60,61,62,63,64,65,66,104,105,109,132,133,135,174,191,193,201,203,208,209,215,217,],[73,73,-28,-30,-31,-32,-33,-34,-35,-36,-25,-29,-48,-44,-45,-47,-46,-109,-41,-37,-40,-38,-39,-42,-43,]),'CONTINUE':([55,57,59,60,61,62,63,64,65,66,104,105,109,132,133,135,174,191,193,201,203,208,209,215,217,],[74,74,-28,-30,-31,-32,-33,-34,-35,-36,-25,-29,-48,-44,-45,-47,-46,-109,-41,-37,-40,-38,-39,-42,-43,]),'RETURN':([55,57,59,60,61,62,63,64,65,66,104,105,109,132,133,135,174,191,193,201,203,208,209,215,217,],[75,75,-28,-30,-31,-32,-33,-34,-35,-36,-25,-29,-48,-44,-45,-47,-46,-109,-41,-37,-40,-38,-39,-42,-43,]),'NEW':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[91,91,-28,-30,-31,-32,-33,-34,-35,-36,91,91,91,91,91,91,91,91,-25,-29,91,-48,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,-44,-45,-47,91,-46,91,91,91,91,91,91,-109,-41,91,91,-37,-40,91,-38,-39,91,-42,-43,]),'LNOT':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[94,94,-28,-30,-31,-32,-33,-34,-35,-36,94,94,94,94,94,94,94,94,-25,-29,94,-48,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,-44,-45,-47,94,-46,94,94,94,94,94,94,-109,-41,94,94,-37,-40,94,-38,-39,94,-42,-43,]),'INCREMENT':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[95,95,-28,-30,-31,-32,-33,-34,-35,-36,95,95,95,95,95,95,95,95,-25,-29,95,-48,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,-44,-45,-47,95,-46,95,95,95,95,95,95,-109,-41,95,95,-37,-40,95,-38,-39,95,-42,-43,]),'DECREMENT':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[96,96,-28,-30,-31,-32,-33,-34,-35,-36,96,96,96,96,96,96,96,96,-25,-29,96,-48,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,-44,-45,-47,96,-46,96,96,96,96,96,96,-109,-41,96,96,-37,-40,96,-38,-39,96,-42,-43,]),'ID':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[97,97,-28,-30,-31,-32,-33,-34,-35,-36,97,97,97,97,97,97,97,97,-25,-29,97,-48,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,-44,-45,-47,97,-46,97,97,97,97,97,97,-109,-41,97,97,-37,-40,97,-38,-39,97,-42,-43,]),'INTEGER':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[98,98,-28,-30,-31,-32,-33,-34,-35,-36,98,98,98,98,98,98,98,98,-25,-29,98,-48,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,-44,-45,-47,98,-46,98,98,98,98,98,98,-109,-41,98,98,-37,-40,98,-38,-39,98,-42,-43,]),'FLOAT':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[99,99,-28,-30,-31,-32,-33,-34,-35,-36,99,99,99,99,99,99,99,99,-25,-29,99,-48,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,-44,-45,-47,99,-46,99,99,99,99,99,99,-109,-41,99,99,-37,-40,99,-38,-39,99,-42,-43,]),'STRING':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[100,100,-28,-30,-31,-32,-33,-34,-35,-36,100,100,100,100,100,100,100,100,-25,-29,100,-48,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,-44,-45,-47,100,-46,100,100,100,100,100,100,-109,-41,100,100,-37,-40,100,-38,-39,100,-42,-43,]),'TRUE':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[101,101,-28,-30,-31,-32,-33,-34,-35,-36,101,101,101,101,101,101,101,101,-25,-29,101,-48,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,-44,-45,-47,101,-46,101,101,101,101,101,101,-109,-41,101,101,-37,-40,101,-38,-39,101,-42,-43,]),'FALSE':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[102,102,-28,-30,-31,-32,-33,-34,-35,-36,102,102,102,102,102,102,102,102,-25,-29,102,-48,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,-44,-45,-47,102,-46,102,102,102,102,102,102,-109,-41,102,102,-37,-40,102,-38,-39,102,-42,-43,]),'NULL':([55,57,59,60,61,62,63,64,65,66,68,75,92,93,94,95,96,97,104,105,106,109,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,132,133,135,169,174,175,177,178,181,183,186,191,193,195,200,201,203,205,208,209,211,215,217,],[103,103,-28,-30,-31,-32,-33,-34,-35,-36,103,103,103,103,103,103,103,103,-25,-29,103,-48,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,-44,-45,-47,103,-46,103,103,103,103,103,103,-109,-41,103,103,-37,-40,103,-38,-39,103,-42,-43,]),'ELSE':([104,191,],[-25,202,]),}
 
 _lr_action = {}
 for _k, _v in _lr_action_items.items():
@@ -16,7 +16,7 @@ for _k, _v in _lr_action_items.items():
       _lr_action[_x][_k] = _y
 del _lr_action_items
 
-_lr_goto_items = {'Program':([0,],[1,]),'Declarations':([0,],[2,]),'empty':([0,14,16,33,40,113,118,156,157,161,166,175,],[3,20,24,24,43,150,154,154,154,150,174,150,]),'Declaration':([2,],[4,]),'FunctionDecl':([2,],[5,]),'StructDecl':([2,],[6,]),'Type':([2,14,16,29,31,33,76,],[7,17,26,17,26,26,120,]),'Name':([2,7,9,14,16,17,26,29,31,33,40,42,53,59,76,77,78,79,80,81,82,91,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[8,11,13,8,8,27,32,8,8,8,75,75,75,75,119,75,75,75,75,75,75,75,129,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,]),'ParametersOpt':([14,],[18,]),'Parameters':([14,],[19,]),'Parameter':([14,29,],[21,34,]),'VarDeclsOpt':([16,33,],[22,37,]),'VarDecls':([16,33,],[23,23,]),'VarDecl':([16,31,33,],[25,36,25,]),'Block':([38,158,160,173,179,],[39,166,167,176,180,]),'StatementsOpt':([40,],[41,]),'Statements':([40,],[42,]),'Statement':([40,42,],[44,90,]),'IfStatement':([40,42,173,],[45,45,177,]),'WhileStatement':([40,42,],[46,46,]),'ForStatement':([40,42,],[47,47,]),'BreakStatement':([40,42,],[48,48,]),'ContinueStatement':([40,42,],[49,49,]),'ReturnStatement':([40,42,],[50,50,]),'ExpressionStatement':([40,42,],[51,51,]),'Expression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[54,54,92,116,121,122,123,124,125,126,127,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,149,155,155,155,149,169,149,]),'Literal':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,]),'NameExpression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,]),'ParenthesizedExpression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,]),'CallExpression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,]),'NewExpression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,]),'ArrayExpression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,]),'FieldAccessExpression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,]),'ArrayIndexExpression':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,]),'UnaryPrefixOperation':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,]),'BinaryOperation':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,]),'IntegerLiteral':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,]),'FloatLiteral':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,]),'StringLiteral':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,]),'BooleanLiteral':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,]),'NullLiteral':([40,42,53,59,77,78,79,80,81,82,91,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,156,157,161,163,175,],[74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,]),'ExpressionOpt':([113,161,175,],[148,168,178,]),'ArgumentsOpt':([118,156,157,],[152,164,165,]),'Arguments':([118,156,157,],[153,153,153,]),'ElseOpt':([166,],[172,]),}
+_lr_goto_items = {'Program':([0,],[1,]),'Declarations':([0,],[2,]),'empty':([0,17,23,30,45,55,129,131,169,175,177,183,191,195,205,211,],[3,27,34,34,34,58,168,172,168,172,172,168,203,168,168,168,]),'Declaration':([2,],[4,]),'FunctionDecl':([2,],[5,]),'StructDecl':([2,],[6,]),'Type':([2,15,17,23,30,31,39,43,45,91,],[7,22,24,36,36,41,24,36,36,138,]),'Name':([2,7,9,14,15,17,23,24,30,31,36,39,43,45,55,57,68,75,91,92,93,94,95,96,97,106,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[8,12,16,20,21,21,21,37,21,21,44,21,21,21,72,72,108,108,136,108,108,108,108,108,108,108,147,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,]),'MapType':([2,15,17,23,30,31,39,43,45,91,],[10,10,10,10,10,10,10,10,10,137,]),'ParametersOpt':([17,],[25,]),'Parameters':([17,],[26,]),'Parameter':([17,39,],[28,46,]),'VarDeclsOpt':([23,30,45,],[32,40,51,]),'VarDecls':([23,30,45,],[33,33,33,]),'VarDecl':([23,30,43,45,],[35,35,50,35,]),'Block':([53,179,182,202,213,216,],[54,191,193,208,215,217,]),'StatementsOpt':([55,],[56,]),'Statements':([55,],[57,]),'Statement':([55,57,],[59,105,]),'IfStatement':([55,57,202,],[60,60,209,]),'WhileStatement':([55,57,],[61,61,]),'ForStatement':([55,57,],[62,62,]),'BreakStatement':([55,57,],[63,63,]),'ContinueStatement':([55,57,],[64,64,]),'ReturnStatement':([55,57,],[65,65,]),'ExpressionStatement':([55,57,],[66,66,]),'Expression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[69,69,107,134,139,140,141,142,143,144,145,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,173,167,173,173,190,192,167,196,167,207,167,167,]),'Literal':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,]),'NameExpression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,]),'ParenthesizedExpression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,]),'CallExpression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,]),'NewExpression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,]),'ArrayExpression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,]),'FieldAccessExpression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,]),'ArrayIndexExpression':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,]),'UnaryPrefixOperation':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,]),'BinaryOperation':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,]),'IntegerLiteral':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,]),'FloatLiteral':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,]),'StringLiteral':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,]),'BooleanLiteral':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,]),'NullLiteral':([55,57,68,75,92,93,94,95,96,97,106,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,131,169,175,177,178,181,183,186,195,200,205,211,],[90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,]),'ExpressionOpt':([129,169,183,195,205,211,],[166,184,194,206,210,214,]),'ArgumentsOpt':([131,175,177,],[170,187,189,]),'Arguments':([131,175,177,],[171,171,171,]),'ElseOpt':([191,],[201,]),}
 
 _lr_goto = {}
 for _k, _v in _lr_goto_items.items():
@@ -26,104 +26,113 @@ for _k, _v in _lr_goto_items.items():
 del _lr_goto_items
 _lr_productions = [
   ("S' -> Program","S'",1,None,None,None),
-  ('Program -> Declarations','Program',1,'p_program','ucparser.py',187),
-  ('Declarations -> Declarations Declaration','Declarations',2,'p_declarations','ucparser.py',192),
-  ('Declarations -> empty','Declarations',1,'p_declarations','ucparser.py',193),
-  ('Declaration -> FunctionDecl','Declaration',1,'p_declaration','ucparser.py',203),
-  ('Declaration -> StructDecl','Declaration',1,'p_declaration','ucparser.py',204),
-  ('StructDecl -> STRUCT Name LPAREN VarDeclsOpt RPAREN SEMI','StructDecl',6,'p_structdecl','ucparser.py',210),
-  ('VarDeclsOpt -> VarDecls','VarDeclsOpt',1,'p_vardeclsopt','ucparser.py',215),
-  ('VarDeclsOpt -> empty','VarDeclsOpt',1,'p_vardeclsopt','ucparser.py',216),
-  ('VarDecls -> VarDecl','VarDecls',1,'p_vardecls','ucparser.py',222),
-  ('VarDecls -> VarDecls COMMA VarDecl','VarDecls',3,'p_vardecls','ucparser.py',223),
-  ('VarDecl -> Type Name','VarDecl',2,'p_vardecl','ucparser.py',233),
-  ('Type -> Name','Type',1,'p_type','ucparser.py',238),
-  ('Type -> Type LBRACKET RBRACKET','Type',3,'p_type','ucparser.py',239),
-  ('Name -> IDENT','Name',1,'p_name','ucparser.py',248),
-  ('ParametersOpt -> Parameters','ParametersOpt',1,'p_parametersopt','ucparser.py',253),
-  ('ParametersOpt -> empty','ParametersOpt',1,'p_parametersopt','ucparser.py',254),
-  ('Parameters -> Parameter','Parameters',1,'p_parameters','ucparser.py',260),
-  ('Parameters -> Parameters COMMA Parameter','Parameters',3,'p_parameters','ucparser.py',261),
-  ('Parameter -> Type Name','Parameter',2,'p_parameter','ucparser.py',271),
-  ('FunctionDecl -> Type Name LPAREN ParametersOpt RPAREN LPAREN VarDeclsOpt RPAREN Block','FunctionDecl',9,'p_functiondecl','ucparser.py',276),
-  ('Block -> LBRACE StatementsOpt RBRACE','Block',3,'p_block','ucparser.py',282),
-  ('StatementsOpt -> Statements','StatementsOpt',1,'p_statementsopt','ucparser.py',287),
-  ('StatementsOpt -> empty','StatementsOpt',1,'p_statementsopt','ucparser.py',288),
-  ('Statements -> Statement','Statements',1,'p_statements','ucparser.py',294),
-  ('Statements -> Statements Statement','Statements',2,'p_statements','ucparser.py',295),
-  ('Statement -> IfStatement','Statement',1,'p_statement','ucparser.py',305),
-  ('Statement -> WhileStatement','Statement',1,'p_statement','ucparser.py',306),
-  ('Statement -> ForStatement','Statement',1,'p_statement','ucparser.py',307),
-  ('Statement -> BreakStatement','Statement',1,'p_statement','ucparser.py',308),
-  ('Statement -> ContinueStatement','Statement',1,'p_statement','ucparser.py',309),
-  ('Statement -> ReturnStatement','Statement',1,'p_statement','ucparser.py',310),
-  ('Statement -> ExpressionStatement','Statement',1,'p_statement','ucparser.py',311),
-  ('IfStatement -> IF LPAREN Expression RPAREN Block ElseOpt','IfStatement',6,'p_ifstatement','ucparser.py',317),
-  ('ElseOpt -> ELSE Block','ElseOpt',2,'p_elseopt','ucparser.py',322),
-  ('ElseOpt -> ELSE IfStatement','ElseOpt',2,'p_elseopt','ucparser.py',323),
-  ('ElseOpt -> empty','ElseOpt',1,'p_elseopt','ucparser.py',324),
-  ('WhileStatement -> WHILE LPAREN Expression RPAREN Block','WhileStatement',5,'p_whilestatement','ucparser.py',334),
-  ('ForStatement -> FOR LPAREN ExpressionOpt SEMI ExpressionOpt SEMI ExpressionOpt RPAREN Block','ForStatement',9,'p_forstatement','ucparser.py',339),
-  ('BreakStatement -> BREAK SEMI','BreakStatement',2,'p_breakstatement','ucparser.py',345),
-  ('ContinueStatement -> CONTINUE SEMI','ContinueStatement',2,'p_continuestatement','ucparser.py',350),
-  ('ReturnStatement -> RETURN Expression SEMI','ReturnStatement',3,'p_returnstatement','ucparser.py',355),
-  ('ReturnStatement -> RETURN SEMI','ReturnStatement',2,'p_returnstatement','ucparser.py',356),
-  ('ExpressionStatement -> Expression SEMI','ExpressionStatement',2,'p_expressionstatement','ucparser.py',365),
-  ('Expression -> Literal','Expression',1,'p_expression','ucparser.py',370),
-  ('Expression -> NameExpression','Expression',1,'p_expression','ucparser.py',371),
-  ('Expression -> ParenthesizedExpression','Expression',1,'p_expression','ucparser.py',372),
-  ('Expression -> CallExpression','Expression',1,'p_expression','ucparser.py',373),
-  ('Expression -> NewExpression','Expression',1,'p_expression','ucparser.py',374),
-  ('Expression -> ArrayExpression','Expression',1,'p_expression','ucparser.py',375),
-  ('Expression -> FieldAccessExpression','Expression',1,'p_expression','ucparser.py',376),
-  ('Expression -> ArrayIndexExpression','Expression',1,'p_expression','ucparser.py',377),
-  ('Expression -> UnaryPrefixOperation','Expression',1,'p_expression','ucparser.py',378),
-  ('Expression -> BinaryOperation','Expression',1,'p_expression','ucparser.py',379),
-  ('ExpressionOpt -> Expression','ExpressionOpt',1,'p_expressionopt','ucparser.py',385),
-  ('ExpressionOpt -> empty','ExpressionOpt',1,'p_expressionopt','ucparser.py',386),
-  ('Literal -> IntegerLiteral','Literal',1,'p_literal','ucparser.py',396),
-  ('Literal -> FloatLiteral','Literal',1,'p_literal','ucparser.py',397),
-  ('Literal -> StringLiteral','Literal',1,'p_literal','ucparser.py',398),
-  ('Literal -> BooleanLiteral','Literal',1,'p_literal','ucparser.py',399),
-  ('Literal -> NullLiteral','Literal',1,'p_literal','ucparser.py',400),
-  ('IntegerLiteral -> INTEGER','IntegerLiteral',1,'p_integerliteral','ucparser.py',406),
-  ('FloatLiteral -> FLOAT','FloatLiteral',1,'p_floatliteral','ucparser.py',411),
-  ('StringLiteral -> STRING','StringLiteral',1,'p_stringliteral','ucparser.py',416),
-  ('BooleanLiteral -> TRUE','BooleanLiteral',1,'p_booleanliteral','ucparser.py',421),
-  ('BooleanLiteral -> FALSE','BooleanLiteral',1,'p_booleanliteral','ucparser.py',422),
-  ('NullLiteral -> NULL','NullLiteral',1,'p_nullliteral','ucparser.py',428),
-  ('NameExpression -> Name','NameExpression',1,'p_nameexpression','ucparser.py',433),
-  ('ParenthesizedExpression -> LPAREN Expression RPAREN','ParenthesizedExpression',3,'p_parenthesizedexpression','ucparser.py',438),
-  ('CallExpression -> Name LPAREN ArgumentsOpt RPAREN','CallExpression',4,'p_callexpression','ucparser.py',443),
-  ('ArgumentsOpt -> Arguments','ArgumentsOpt',1,'p_argumentsopt','ucparser.py',448),
-  ('ArgumentsOpt -> empty','ArgumentsOpt',1,'p_argumentsopt','ucparser.py',449),
-  ('Arguments -> Expression','Arguments',1,'p_arguments','ucparser.py',455),
-  ('Arguments -> Arguments COMMA Expression','Arguments',3,'p_arguments','ucparser.py',456),
-  ('NewExpression -> NEW Name LPAREN ArgumentsOpt RPAREN','NewExpression',5,'p_newexpression','ucparser.py',466),
-  ('ArrayExpression -> NEW Type LBRACE ArgumentsOpt RBRACE','ArrayExpression',5,'p_arrayexpression','ucparser.py',471),
-  ('FieldAccessExpression -> Expression PERIOD Name','FieldAccessExpression',3,'p_fieldaccessexpression','ucparser.py',476),
-  ('ArrayIndexExpression -> Expression LBRACKET Expression RBRACKET','ArrayIndexExpression',4,'p_arrayindexexpression','ucparser.py',481),
-  ('UnaryPrefixOperation -> PLUS Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',496),
-  ('UnaryPrefixOperation -> MINUS Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',497),
-  ('UnaryPrefixOperation -> LNOT Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',498),
-  ('UnaryPrefixOperation -> INCREMENT Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',499),
-  ('UnaryPrefixOperation -> DECREMENT Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',500),
-  ('UnaryPrefixOperation -> ID Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',501),
-  ('BinaryOperation -> Expression PLUS Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',527),
-  ('BinaryOperation -> Expression MINUS Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',528),
-  ('BinaryOperation -> Expression TIMES Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',529),
-  ('BinaryOperation -> Expression DIVIDE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',530),
-  ('BinaryOperation -> Expression MODULO Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',531),
-  ('BinaryOperation -> Expression LOR Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',532),
-  ('BinaryOperation -> Expression LAND Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',533),
-  ('BinaryOperation -> Expression LT Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',534),
-  ('BinaryOperation -> Expression LE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',535),
-  ('BinaryOperation -> Expression GT Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',536),
-  ('BinaryOperation -> Expression GE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',537),
-  ('BinaryOperation -> Expression EQ Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',538),
-  ('BinaryOperation -> Expression NE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',539),
-  ('BinaryOperation -> Expression EQUALS Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',540),
-  ('BinaryOperation -> Expression PUSH Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',541),
-  ('BinaryOperation -> Expression POP Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',542),
-  ('empty -> <empty>','empty',0,'p_empty','ucparser.py',548),
+  ('Program -> Declarations','Program',1,'p_program','ucparser.py',188),
+  ('Declarations -> Declarations Declaration','Declarations',2,'p_declarations','ucparser.py',194),
+  ('Declarations -> empty','Declarations',1,'p_declarations','ucparser.py',195),
+  ('Declaration -> FunctionDecl','Declaration',1,'p_declaration','ucparser.py',205),
+  ('Declaration -> StructDecl','Declaration',1,'p_declaration','ucparser.py',206),
+  ('StructDecl -> STRUCT Name LPAREN VarDeclsOpt RPAREN SEMI','StructDecl',6,'p_structdecl','ucparser.py',212),
+  ('StructDecl -> Name STRUCT Name LPAREN VarDeclsOpt RPAREN SEMI','StructDecl',7,'p_valuestructdecl','ucparser.py',219),
+  ('VarDeclsOpt -> VarDecls','VarDeclsOpt',1,'p_vardeclsopt','ucparser.py',229),
+  ('VarDeclsOpt -> empty','VarDeclsOpt',1,'p_vardeclsopt','ucparser.py',230),
+  ('VarDecls -> VarDecl','VarDecls',1,'p_vardecls','ucparser.py',236),
+  ('VarDecls -> VarDecls COMMA VarDecl','VarDecls',3,'p_vardecls','ucparser.py',237),
+  ('VarDecl -> Type Name','VarDecl',2,'p_vardecl','ucparser.py',247),
+  ('Type -> Name','Type',1,'p_type','ucparser.py',252),
+  ('Type -> Type LBRACKET RBRACKET','Type',3,'p_type','ucparser.py',253),
+  ('Type -> Type LBRACKET COMMA RBRACKET','Type',4,'p_type_matrix','ucparser.py',262),
+  ('Type -> MapType','Type',1,'p_type_map','ucparser.py',267),
+  ('MapType -> Name LT Type COMMA Type GT','MapType',6,'p_maptype','ucparser.py',274),
+  ('Name -> IDENT','Name',1,'p_name','ucparser.py',284),
+  ('ParametersOpt -> Parameters','ParametersOpt',1,'p_parametersopt','ucparser.py',289),
+  ('ParametersOpt -> empty','ParametersOpt',1,'p_parametersopt','ucparser.py',290),
+  ('Parameters -> Parameter','Parameters',1,'p_parameters','ucparser.py',296),
+  ('Parameters -> Parameters COMMA Parameter','Parameters',3,'p_parameters','ucparser.py',297),
+  ('Parameter -> Type Name','Parameter',2,'p_parameter','ucparser.py',307),
+  ('FunctionDecl -> Type Name LPAREN ParametersOpt RPAREN LPAREN VarDeclsOpt RPAREN Block','FunctionDecl',9,'p_functiondecl','ucparser.py',312),
+  ('Block -> LBRACE StatementsOpt RBRACE','Block',3,'p_block','ucparser.py',318),
+  ('StatementsOpt -> Statements','StatementsOpt',1,'p_statementsopt','ucparser.py',323),
+  ('StatementsOpt -> empty','StatementsOpt',1,'p_statementsopt','ucparser.py',324),
+  ('Statements -> Statement','Statements',1,'p_statements','ucparser.py',330),
+  ('Statements -> Statements Statement','Statements',2,'p_statements','ucparser.py',331),
+  ('Statement -> IfStatement','Statement',1,'p_statement','ucparser.py',341),
+  ('Statement -> WhileStatement','Statement',1,'p_statement','ucparser.py',342),
+  ('Statement -> ForStatement','Statement',1,'p_statement','ucparser.py',343),
+  ('Statement -> BreakStatement','Statement',1,'p_statement','ucparser.py',344),
+  ('Statement -> ContinueStatement','Statement',1,'p_statement','ucparser.py',345),
+  ('Statement -> ReturnStatement','Statement',1,'p_statement','ucparser.py',346),
+  ('Statement -> ExpressionStatement','Statement',1,'p_statement','ucparser.py',347),
+  ('IfStatement -> IF LPAREN Expression RPAREN Block ElseOpt','IfStatement',6,'p_ifstatement','ucparser.py',353),
+  ('ElseOpt -> ELSE Block','ElseOpt',2,'p_elseopt','ucparser.py',358),
+  ('ElseOpt -> ELSE IfStatement','ElseOpt',2,'p_elseopt','ucparser.py',359),
+  ('ElseOpt -> empty','ElseOpt',1,'p_elseopt','ucparser.py',360),
+  ('WhileStatement -> WHILE LPAREN Expression RPAREN Block','WhileStatement',5,'p_whilestatement','ucparser.py',370),
+  ('ForStatement -> FOR LPAREN ExpressionOpt SEMI ExpressionOpt SEMI ExpressionOpt RPAREN Block','ForStatement',9,'p_forstatement','ucparser.py',375),
+  ('ForStatement -> Name FOR LPAREN ExpressionOpt SEMI ExpressionOpt SEMI ExpressionOpt RPAREN Block','ForStatement',10,'p_parallelforstatement','ucparser.py',387),
+  ('BreakStatement -> BREAK SEMI','BreakStatement',2,'p_breakstatement','ucparser.py',399),
+  ('ContinueStatement -> CONTINUE SEMI','ContinueStatement',2,'p_continuestatement','ucparser.py',404),
+  ('ReturnStatement -> RETURN Expression SEMI','ReturnStatement',3,'p_returnstatement','ucparser.py',409),
+  ('ReturnStatement -> RETURN SEMI','ReturnStatement',2,'p_returnstatement','ucparser.py',410),
+  ('ExpressionStatement -> Expression SEMI','ExpressionStatement',2,'p_expressionstatement','ucparser.py',419),
+  ('Expression -> Literal','Expression',1,'p_expression','ucparser.py',424),
+  ('Expression -> NameExpression','Expression',1,'p_expression','ucparser.py',425),
+  ('Expression -> ParenthesizedExpression','Expression',1,'p_expression','ucparser.py',426),
+  ('Expression -> CallExpression','Expression',1,'p_expression','ucparser.py',427),
+  ('Expression -> NewExpression','Expression',1,'p_expression','ucparser.py',428),
+  ('Expression -> ArrayExpression','Expression',1,'p_expression','ucparser.py',429),
+  ('Expression -> FieldAccessExpression','Expression',1,'p_expression','ucparser.py',430),
+  ('Expression -> ArrayIndexExpression','Expression',1,'p_expression','ucparser.py',431),
+  ('Expression -> UnaryPrefixOperation','Expression',1,'p_expression','ucparser.py',432),
+  ('Expression -> BinaryOperation','Expression',1,'p_expression','ucparser.py',433),
+  ('ExpressionOpt -> Expression','ExpressionOpt',1,'p_expressionopt','ucparser.py',439),
+  ('ExpressionOpt -> empty','ExpressionOpt',1,'p_expressionopt','ucparser.py',440),
+  ('Literal -> IntegerLiteral','Literal',1,'p_literal','ucparser.py',450),
+  ('Literal -> FloatLiteral','Literal',1,'p_literal','ucparser.py',451),
+  ('Literal -> StringLiteral','Literal',1,'p_literal','ucparser.py',452),
+  ('Literal -> BooleanLiteral','Literal',1,'p_literal','ucparser.py',453),
+  ('Literal -> NullLiteral','Literal',1,'p_literal','ucparser.py',454),
+  ('IntegerLiteral -> INTEGER','IntegerLiteral',1,'p_integerliteral','ucparser.py',460),
+  ('FloatLiteral -> FLOAT','FloatLiteral',1,'p_floatliteral','ucparser.py',465),
+  ('StringLiteral -> STRING','StringLiteral',1,'p_stringliteral','ucparser.py',470),
+  ('BooleanLiteral -> TRUE','BooleanLiteral',1,'p_booleanliteral','ucparser.py',475),
+  ('BooleanLiteral -> FALSE','BooleanLiteral',1,'p_booleanliteral','ucparser.py',476),
+  ('NullLiteral -> NULL','NullLiteral',1,'p_nullliteral','ucparser.py',482),
+  ('NameExpression -> Name','NameExpression',1,'p_nameexpression','ucparser.py',487),
+  ('ParenthesizedExpression -> LPAREN Expression RPAREN','ParenthesizedExpression',3,'p_parenthesizedexpression','ucparser.py',492),
+  ('CallExpression -> Name LPAREN ArgumentsOpt RPAREN','CallExpression',4,'p_callexpression','ucparser.py',497),
+  ('ArgumentsOpt -> Arguments','ArgumentsOpt',1,'p_argumentsopt','ucparser.py',502),
+  ('ArgumentsOpt -> empty','ArgumentsOpt',1,'p_argumentsopt','ucparser.py',503),
+  ('Arguments -> Expression','Arguments',1,'p_arguments','ucparser.py',509),
+  ('Arguments -> Arguments COMMA Expression','Arguments',3,'p_arguments','ucparser.py',510),
+  ('NewExpression -> NEW Name LPAREN ArgumentsOpt RPAREN','NewExpression',5,'p_newexpression','ucparser.py',520),
+  ('NewExpression -> NEW MapType LPAREN RPAREN','NewExpression',4,'p_newmapexpression','ucparser.py',525),
+  ('ArrayExpression -> NEW Type LBRACE ArgumentsOpt RBRACE','ArrayExpression',5,'p_arrayexpression','ucparser.py',530),
+  ('ArrayExpression -> NEW Type LBRACKET Expression RBRACKET','ArrayExpression',5,'p_sizedarrayexpression','ucparser.py',535),
+  ('ArrayExpression -> NEW Type LBRACKET Expression COMMA Expression RBRACKET','ArrayExpression',7,'p_matrixexpression','ucparser.py',540),
+  ('FieldAccessExpression -> Expression PERIOD Name','FieldAccessExpression',3,'p_fieldaccessexpression','ucparser.py',546),
+  ('ArrayIndexExpression -> Expression LBRACKET Expression RBRACKET','ArrayIndexExpression',4,'p_arrayindexexpression','ucparser.py',551),
+  ('ArrayIndexExpression -> Expression LBRACKET Expression COMMA Expression RBRACKET','ArrayIndexExpression',6,'p_matrixindexexpression','ucparser.py',556),
+  ('UnaryPrefixOperation -> PLUS Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',572),
+  ('UnaryPrefixOperation -> MINUS Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',573),
+  ('UnaryPrefixOperation -> LNOT Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',574),
+  ('UnaryPrefixOperation -> INCREMENT Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',575),
+  ('UnaryPrefixOperation -> DECREMENT Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',576),
+  ('UnaryPrefixOperation -> ID Expression','UnaryPrefixOperation',2,'p_unaryprefixoperation','ucparser.py',577),
+  ('BinaryOperation -> Expression PLUS Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',603),
+  ('BinaryOperation -> Expression MINUS Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',604),
+  ('BinaryOperation -> Expression TIMES Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',605),
+  ('BinaryOperation -> Expression DIVIDE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',606),
+  ('BinaryOperation -> Expression MODULO Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',607),
+  ('BinaryOperation -> Expression LOR Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',608),
+  ('BinaryOperation -> Expression LAND Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',609),
+  ('BinaryOperation -> Expression LT Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',610),
+  ('BinaryOperation -> Expression LE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',611),
+  ('BinaryOperation -> Expression GT Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',612),
+  ('BinaryOperation -> Expression GE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',613),
+  ('BinaryOperation -> Expression EQ Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',614),
+  ('BinaryOperation -> Expression NE Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',615),
+  ('BinaryOperation -> Expression EQUALS Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',616),
+  ('BinaryOperation -> Expression PUSH Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',617),
+  ('BinaryOperation -> Expression POP Expression','BinaryOperation',3,'p_binaryoperation','ucparser.py',618),
+  ('empty -> <empty>','empty',0,'p_empty','ucparser.py',624),
 ]
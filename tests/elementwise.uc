@@ -0,0 +1,33 @@
+void main(string[] args)(float[] xs, float[] ys, float[] zs, int i) {
+  xs = new float[args.length];
+  for (i = 0; i < args.length; ++i) {
+    xs[i] = string_to_float(args[i]);
+  }
+  ys = new float{1.0, 2.0, 3.0, 4.0};
+
+  print_floats(sqrt_all(new float{4.0, 2.25, 0.0, 100.0}));
+  print_floats(add_all(xs, ys));
+  print_floats(mul_all(xs, ys));
+
+  axpy(0.5, xs, ys);
+  print_floats(ys);
+  axpy(-1.0, ys, ys);
+  print_floats(ys);
+
+  zs = new float[1000];
+  for (i = 0; i < zs.length; ++i) {
+    zs[i] = i * i;
+  }
+  zs = sqrt_all(zs);
+  axpy(2.0, zs, zs);
+  println("" + zs[999] + " " + sum(mul_all(zs, zs)) + " " +
+          sqrt_all(new float[0]).length);
+}
+
+void print_floats(float[] xs)(int i, string line) {
+  line = "";
+  for (i = 0; i < xs.length; ++i) {
+    line = line + xs[i] + " ";
+  }
+  println(line);
+}
@@ -0,0 +1,17 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "elementwise.cpp"
+
+
+}
+
+int main() {
+  return 0;
+}
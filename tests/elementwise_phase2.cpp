@@ -0,0 +1,21 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "elementwise.cpp"
+
+  void test() {
+    UC_FUNCTION(print_floats)(uc_make_array_of<UC_PRIMITIVE(float)>());
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
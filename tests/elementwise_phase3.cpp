@@ -0,0 +1,42 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "elementwise.cpp"
+
+  void test_default() {
+    UC_ARRAY(UC_PRIMITIVE(float)) var0 =
+      uc_make_array_of_size<UC_PRIMITIVE(float)>(10);
+    assert(UC_FUNCTION(sqrt_all)(var0) == var0);
+    assert(UC_FUNCTION(add_all)(var0, var0) == var0);
+    assert(UC_FUNCTION(mul_all)(var0, var0) == var0);
+  }
+
+  void test_non_default_with_defaults() {
+  }
+
+  void test_non_default_with_non_defaults() {
+    UC_ARRAY(UC_PRIMITIVE(float)) var0 =
+      uc_make_array_of<UC_PRIMITIVE(float)>(1.0, 4.0, 9.0);
+    UC_ARRAY(UC_PRIMITIVE(float)) var1 =
+      uc_make_array_of<UC_PRIMITIVE(float)>(1.0, 2.0, 3.0);
+    assert(UC_FUNCTION(sqrt_all)(var0) == var1);
+    assert(UC_FUNCTION(mul_all)(var1, var1) == var0);
+    UC_FUNCTION(axpy)(-1.0, var1, var0);
+    assert(uc_array_index(var0, 2) == 6.0);
+    assert(uc_array_index(var1, 2) == 3.0);
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
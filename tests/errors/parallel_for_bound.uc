@@ -0,0 +1,14 @@
+void main(string[] args)(int i, float lim, long end, int[] a) {
+  lim = 3.5;
+  end = 3L;
+  a = new int[4];
+  parallel for (i = 0; i < lim; ++i) {
+    a[i] = i;
+  }
+  parallel for (i = 0; i <= end; ++i) {
+    a[i] = i;
+  }
+  parallel for (i = 0; i < a.length; ++i) {
+    a[i] = i;
+  }
+}
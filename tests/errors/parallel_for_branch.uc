@@ -0,0 +1,11 @@
+void main(string[] args)(int i, int t, int[] a) {
+  a = new int[3];
+  t = 5;
+  parallel for (i = 0; i < 3; ++i) {
+    if (i == 0) {
+      t = 5;
+    }
+    a[i] = t;
+  }
+  println("" + a[0] + a[1] + a[2] + " " + t);
+}
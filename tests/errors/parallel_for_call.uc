@@ -0,0 +1,32 @@
+void main(string[] args)(int i, map<int, int> m, map<int, int> t,
+                         int[] a, int[][] rows, counter c) {
+  m = new map<int, int>();
+  a = new int[4];
+  rows = new int[]{new int[2], new int[2]};
+  c = new counter(0);
+  parallel for (i = 0; i < 2; ++i) {
+    put(m, i, i);
+    sort(a);
+    t = new map<int, int>();
+    put(t, i, i);
+    sort(rows[i]);
+    bump(c, i);
+    store(m, i);
+    store(t, i);
+    a[i] = count(a, i);
+  }
+}
+
+void bump(counter c, int n)() {
+  c.n = c.n + n;
+}
+
+void store(map<int, int> m, int n)() {
+  put(m, n, count(new int[n], n));
+}
+
+int count(int[] a, int n)() {
+  return a.length + n;
+}
+
+struct counter(int n);
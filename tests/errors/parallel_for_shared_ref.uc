@@ -0,0 +1,15 @@
+void main(string[] args)(int i, counter p, int[] a, counter q) {
+  p = new counter(0);
+  a = new int[3];
+  parallel for (i = 0; i < 3; ++i) {
+    p.n = p.n + 1;
+    a[0] = i;
+    a << i;
+    q = new counter(i);
+    q.n = q.n + 1;
+    a[i] = q.n;
+  }
+  println("" + p.n);
+}
+
+struct counter(int n);
@@ -0,0 +1,35 @@
+void main(string[] args)(map<string, int> counts, map<point, string> names,
+                         map<int, int[]> lists, int i) {
+  counts = new map<string, int>();
+  for (i = 0; i < args.length; ++i) {
+    put(counts, args[i], i);
+  }
+  put(counts, "10", 100);
+  println("" + counts.length);
+  println("" + get(counts, "10") + " " + get(counts, "2"));
+  println(boolean_to_string(contains(counts, "5")));
+  remove(counts, "5");
+  println(boolean_to_string(contains(counts, "5")) + " " + counts.length);
+
+  names = new map<point, string>();
+  put(names, new point(1, 2), "a");
+  put(names, null, "none");
+  put(names, new point(1, 2), "b");
+  println(get(names, new point(1, 2)) + " " + get(names, null) + " "
+          + names.length);
+
+  lists = new map<int, int[]>();
+  for (i = 0; i < 1000; ++i) {
+    put(lists, i * 1024, new int{i});
+  }
+  for (i = 0; i < 1000; i = i + 2) {
+    remove(lists, i * 1024);
+  }
+  println("" + lists.length + " " + get(lists, 999 * 1024)[0]);
+  println(boolean_to_string(contains(lists, new int{3}[0] * 1024)));
+  println(boolean_to_string(new box(counts) == new box(counts)));
+}
+
+struct point(int x, int y);
+
+struct box(map<string, int> contents);
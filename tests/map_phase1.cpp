@@ -0,0 +1,20 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "map.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "map.cpp"
+
+  void UC_CONCAT(UC_TYPEDEF(point), _test)(UC_REFERENCE(point));
+  void UC_CONCAT(UC_TYPEDEF(box), _test)(UC_REFERENCE(box));
+
+}
+
+int main() {
+  return 0;
+}
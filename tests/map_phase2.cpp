@@ -0,0 +1,22 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "map.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "map.cpp"
+
+  void test() {
+    UC_FUNCTION(main)(UC_ARRAY(UC_PRIMITIVE(string)){});
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
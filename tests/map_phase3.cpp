@@ -0,0 +1,80 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "map.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "map.cpp"
+
+  void test_default() {
+    UC_REFERENCE(point) var0 = uc_make_object<UC_REFERENCE(point)>();
+    UC_REFERENCE(point) var0b = uc_make_object<UC_REFERENCE(point)>();
+    assert(var0 == var0b);
+    assert(!(var0 != var0b));
+    assert(uc_hash(var0) == uc_hash(var0b));
+    assert(var0->UC_VAR(x) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(y) == UC_PRIMITIVE(int){});
+    UC_REFERENCE(box) var1 = uc_make_object<UC_REFERENCE(box)>();
+    UC_REFERENCE(box) var1b = uc_make_object<UC_REFERENCE(box)>();
+    assert(var1 == var1b);
+    assert(!(var1 != var1b));
+    assert(var1->UC_VAR(contents) == nullptr);
+  }
+
+  void test_non_default_with_defaults() {
+    UC_REFERENCE(point) var0 = uc_make_object<UC_REFERENCE(point)>(UC_PRIMITIVE(int){},
+                                                                   UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(x) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(y) == UC_PRIMITIVE(int){});
+    UC_REFERENCE(box) var1 = uc_make_object<UC_REFERENCE(box)>(UC_MAP(UC_PRIMITIVE(string), UC_PRIMITIVE(int)){});
+    assert(var1->UC_VAR(contents) == nullptr);
+  }
+
+  void test_non_default_with_non_defaults() {
+    UC_PRIMITIVE(int) arg0_0 = 1;
+    UC_PRIMITIVE(int) arg0_0c = 2;
+    UC_PRIMITIVE(int) arg0_1 = 3;
+    UC_PRIMITIVE(int) arg0_1c = 4;
+    UC_REFERENCE(point) var0 = uc_make_object<UC_REFERENCE(point)>(arg0_0,
+                                                                   arg0_1);
+    UC_REFERENCE(point) var0b = uc_make_object<UC_REFERENCE(point)>(arg0_0,
+                                                                    arg0_1);
+    UC_REFERENCE(point) var0c = uc_make_object<UC_REFERENCE(point)>(arg0_0c,
+                                                                    arg0_1c);
+    assert(var0 == var0b);
+    assert(!(var0 != var0b));
+    assert(uc_hash(var0) == uc_hash(var0b));
+    assert(var0 != var0c);
+    assert(!(var0 == var0c));
+    assert(var0->UC_VAR(x) == arg0_0);
+    assert(var0->UC_VAR(y) == arg0_1);
+
+    UC_MAP(UC_PRIMITIVE(string), UC_PRIMITIVE(int)) arg1_0 =
+      uc_make_object<UC_MAP(UC_PRIMITIVE(string), UC_PRIMITIVE(int))>();
+    UC_MAP(UC_PRIMITIVE(string), UC_PRIMITIVE(int)) arg1_0c =
+      uc_make_object<UC_MAP(UC_PRIMITIVE(string), UC_PRIMITIVE(int))>();
+    UC_FUNCTION(put)(arg1_0, "a"s, 1);
+    UC_FUNCTION(put)(arg1_0, "b"s, 2);
+    UC_FUNCTION(put)(arg1_0c, "b"s, 2);
+    UC_FUNCTION(put)(arg1_0c, "a"s, 1);
+    UC_REFERENCE(box) var1 = uc_make_object<UC_REFERENCE(box)>(arg1_0);
+    UC_REFERENCE(box) var1b = uc_make_object<UC_REFERENCE(box)>(arg1_0c);
+    assert(var1 == var1b);
+    assert(uc_hash(var1) == uc_hash(var1b));
+    UC_FUNCTION(put)(arg1_0c, "a"s, 3);
+    assert(var1 != var1b);
+    assert(var1->UC_VAR(contents) == arg1_0);
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
@@ -0,0 +1,59 @@
+void main(string[] args)(int[,] grid, float[,] weights, cell[,] cells,
+                         int i, int gen) {
+  grid = new int[args.length, 6];
+  println("" + grid.rows + " " + grid.cols + " " + grid[3, 5]);
+  for (i = 0; i < grid.rows; ++i) {
+    grid[i, i + 1] = string_to_int(args[i]);
+  }
+  println("" + grid[0, 1] + " " + grid[3, 4]);
+
+  grid = new int[5, 5];
+  grid[1, 2] = 1;
+  grid[2, 2] = 1;
+  grid[3, 2] = 1;
+  for (gen = 0; gen < 2; ++gen) {
+    grid = step(grid);
+    print_grid(grid);
+  }
+
+  weights = new float[2, 3];
+  weights[1, 2] = 0.5;
+  println("" + weights[1, 2] + " " + weights[0, 0]);
+
+  cells = new cell[1, 2];
+  println(boolean_to_string(cells[0, 1] == null));
+  cells[0, 1] = new cell(3, 4, 7, 8);
+  println("" + cells[0, 1].row + cells[0, 1].col);
+  println("" + cells[0, 1].rows + " " + cells[0, 1].cols);
+}
+
+int[,] step(int[,] grid)(int[,] next, int i, int j, int n) {
+  next = new int[grid.rows, grid.cols];
+  for (i = 1; i < grid.rows - 1; ++i) {
+    for (j = 1; j < grid.cols - 1; ++j) {
+      n = grid[i - 1, j - 1] + grid[i - 1, j] + grid[i - 1, j + 1] +
+          grid[i, j - 1] + grid[i, j + 1] +
+          grid[i + 1, j - 1] + grid[i + 1, j] + grid[i + 1, j + 1];
+      if (n == 3 || (n == 2 && grid[i, j] == 1)) {
+        next[i, j] = 1;
+      }
+    }
+  }
+  return next;
+}
+
+void print_grid(int[,] grid)(int i, int j, string line) {
+  for (i = 0; i < grid.rows; ++i) {
+    line = "";
+    for (j = 0; j < grid.cols; ++j) {
+      if (grid[i, j] == 1) {
+        line = line + "#";
+      } else {
+        line = line + ".";
+      }
+    }
+    println(line);
+  }
+}
+
+struct cell(int row, int col, int rows, int cols);
@@ -0,0 +1,18 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "matrix.cpp"
+
+  void UC_CONCAT(UC_TYPEDEF(cell), _test)(UC_REFERENCE(cell));
+
+}
+
+int main() {
+  return 0;
+}
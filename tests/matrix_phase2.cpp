@@ -0,0 +1,23 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "matrix.cpp"
+
+  void test() {
+    UC_MATRIX(UC_PRIMITIVE(int)) grid = UC_FUNCTION(step)(UC_MATRIX(UC_PRIMITIVE(int)){});
+    UC_FUNCTION(print_grid)(UC_MATRIX(UC_PRIMITIVE(int)){});
+    UC_FUNCTION(main)(UC_ARRAY(UC_PRIMITIVE(string)){});
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "matrix.cpp"
+
+  void test_default() {
+    UC_REFERENCE(cell) var0 = uc_make_object<UC_REFERENCE(cell)>();
+    assert(var0->UC_VAR(row) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(col) == UC_PRIMITIVE(int){});
+    assert(uc_rows_field(var0) == UC_PRIMITIVE(int){});
+    assert(uc_cols_field(var0) == UC_PRIMITIVE(int){});
+    UC_MATRIX(UC_REFERENCE(cell)) var1 =
+      uc_make_matrix_of_size<UC_REFERENCE(cell)>(2, 3);
+    assert(uc_rows_field(var1) == 2);
+    assert(uc_cols_field(var1) == 3);
+    assert(uc_matrix_index(var1, 1, 2) == UC_REFERENCE(cell){});
+  }
+
+  void test_non_default_with_defaults() {
+    UC_REFERENCE(cell) var0 = uc_make_object<UC_REFERENCE(cell)>(UC_PRIMITIVE(int){},
+                                                                 UC_PRIMITIVE(int){},
+                                                                 UC_PRIMITIVE(int){},
+                                                                 UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(row) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(col) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(rows) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(cols) == UC_PRIMITIVE(int){});
+  }
+
+  void test_non_default_with_non_defaults() {
+    UC_PRIMITIVE(int) arg0_0 = 1;
+    UC_PRIMITIVE(int) arg0_1 = 2;
+    UC_PRIMITIVE(int) arg0_2 = 3;
+    UC_PRIMITIVE(int) arg0_3 = 4;
+    UC_REFERENCE(cell) var0 = uc_make_object<UC_REFERENCE(cell)>(arg0_0,
+                                                                 arg0_1,
+                                                                 arg0_2,
+                                                                 arg0_3);
+    assert(var0->UC_VAR(row) == arg0_0);
+    assert(var0->UC_VAR(col) == arg0_1);
+    assert(uc_rows_field(var0) == arg0_2);
+    assert(uc_cols_field(var0) == arg0_3);
+    UC_MATRIX(UC_PRIMITIVE(int)) var1 =
+      uc_make_matrix_of_size<UC_PRIMITIVE(int)>(2, 2);
+    UC_MATRIX(UC_PRIMITIVE(int)) var1b =
+      uc_make_matrix_of_size<UC_PRIMITIVE(int)>(2, 2);
+    uc_matrix_index(var1, 1, 0) = arg0_3;
+    assert(var1 != var1b);
+    uc_matrix_index(var1b, 1, 0) = arg0_3;
+    assert(var1 == var1b);
+    assert(uc_hash(var1) == uc_hash(var1b));
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
@@ -0,0 +1,79 @@
+void main(string[] args)(int n, int i, float[] xs, float[] forces,
+                         int[,] grid, int[,] next, int[] counts,
+                         float total) {
+  n = string_to_int(args[0]) * 50;
+  xs = new float[n];
+  forces = new float[n];
+  parallel for (i = 0; i < n; ++i) {
+    xs[i] = i * 0.5;
+  }
+  println("" + i);
+
+  parallel for (i = 0; i < n; i = i + 1) {
+    forces[i] = force(xs, i);
+  }
+  total = 0.0;
+  for (i = 0; i < n; ++i) {
+    total = total + forces[i];
+  }
+  println("" + forces[0] + " " + forces[n - 1] + " " + total);
+
+  grid = new int[8, 8];
+  grid[3, 4] = 1;
+  grid[4, 4] = 1;
+  grid[5, 4] = 1;
+  next = new int[8, 8];
+  step(grid, next);
+  println("" + next[4, 3] + next[4, 4] + next[4, 5] + next[3, 4]);
+
+  counts = new int[10];
+  parallel for (i = 1; i <= 9; ++i) {
+    if (i % 3 == 0) {
+      continue;
+    }
+    counts[i] = i * i;
+  }
+  println("" + i + " " + counts[2] + " " + counts[3] + " " + counts[9] +
+          " " + counts[8]);
+
+  parallel for (i = 5; i < 2; ++i) {
+    counts[i] = 1;
+  }
+  println("" + i + " " + counts[0]);
+
+  parallel for (i = 0; i < 16; ++i) {
+    print("" + i);
+    if (i % 4 == 3) {
+      println("");
+    } else {
+      print(" ");
+    }
+  }
+}
+
+float force(float[] xs, int i)(int j, float sum, float d) {
+  sum = 0.0;
+  for (j = 0; j < xs.length; ++j) {
+    if (j == i) {
+      continue;
+    }
+    d = xs[j] - xs[i];
+    sum = sum + d / (1.0 + d * d);
+  }
+  return sum;
+}
+
+void step(int[,] grid, int[,] next)(int i, int j, int count) {
+  parallel for (i = 1; i < grid.rows - 1; ++i) {
+    parallel for (j = 1; j < grid.cols - 1; ++j) {
+      count = grid[i - 1, j - 1] + grid[i - 1, j] + grid[i - 1, j + 1] +
+              grid[i, j - 1] + grid[i, j + 1] +
+              grid[i + 1, j - 1] + grid[i + 1, j] + grid[i + 1, j + 1];
+      if (count == 3 || (count == 2 && grid[i, j] == 1)) {
+        next[i, j] = 1;
+      } else {
+        next[i, j] = 0;
+      }
+    }
+  }
+}
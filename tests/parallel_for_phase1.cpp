@@ -0,0 +1,19 @@
+#define UC_THREADED
+
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "parallel_for.cpp"
+
+
+}
+
+int main() {
+  return 0;
+}
@@ -0,0 +1,28 @@
+#define UC_THREADED
+
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "parallel_for.cpp"
+
+  void test() {
+    UC_PRIMITIVE(float) (*var0)(UC_ARRAY(UC_PRIMITIVE(float)),
+                                UC_PRIMITIVE(int)) = UC_FUNCTION(force);
+    UC_PRIMITIVE(void) (*var1)(UC_MATRIX(UC_PRIMITIVE(int)),
+                               UC_MATRIX(UC_PRIMITIVE(int))) =
+      UC_FUNCTION(step);
+    assert(var0 && var1);
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
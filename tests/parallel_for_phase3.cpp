@@ -0,0 +1,41 @@
+#define UC_THREADED
+
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "parallel_for.cpp"
+
+  void test_default() {
+    UC_ARRAY(UC_PRIMITIVE(int)) var0 =
+      uc_make_array_of_size<UC_PRIMITIVE(int)>(1000);
+    assert(uc_parallel_for(0, 1000, [&](UC_PRIMITIVE(int) i) {
+      uc_array_index(var0, i)++;
+    }) == 1000);
+    for (UC_PRIMITIVE(int) i = 0; i < 1000; i++) {
+      assert(uc_array_index(var0, i) == 1);
+    }
+    assert(uc_parallel_for(3, 3, [&](UC_PRIMITIVE(int)) {
+      assert(false);
+    }) == 3);
+  }
+
+  void test_non_default_with_defaults() {
+  }
+
+  void test_non_default_with_non_defaults() {
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
@@ -0,0 +1,36 @@
+void main(string[] args)(int[] nums, float[] xs, float[] ys, long[] big,
+                         float[] ones, int n, int i, long total) {
+  nums = new int[args.length];
+  for (i = 0; i < args.length; ++i) {
+    nums[i] = string_to_int(args[i]);
+  }
+  println("" + sum(nums) + " " + min(nums) + " " + max(nums) + " " +
+          dot(nums, nums));
+
+  xs = new float{1.5, -2.25, 4.0, 0.125};
+  ys = new float{2.0, 1.0, -0.5, 8.0};
+  println("" + sum(xs) + " " + min(xs) + " " + max(xs) + " " +
+          dot(xs, ys));
+  println("" + sum(new int[0]) + " " + dot(new float[0], new float[0]));
+
+  n = 200000 + nums[1];
+  big = new long[n];
+  ones = new float[n];
+  total = 0L;
+  for (i = 0; i < n; ++i) {
+    big[i] = (i * 7919) % 100003 - 50000;
+    ones[i] = 1.0;
+    total = total + big[i];
+  }
+  println("" + sum(big) + " " + total);
+  println("" + min(big) + " " + max(big));
+  println("" + sum(ones) + " " + dot(ones, ones));
+  println("" + larger(3.0, 4.5));
+}
+
+float larger(float a, float b)() {
+  if (a < b) {
+    return b;
+  }
+  return a;
+}
@@ -0,0 +1,21 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "reductions.cpp"
+
+  void test() {
+    UC_FUNCTION(larger)(UC_PRIMITIVE(float){}, UC_PRIMITIVE(float){});
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
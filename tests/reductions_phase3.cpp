@@ -0,0 +1,40 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "reductions.cpp"
+
+  void test_default() {
+    UC_ARRAY(UC_PRIMITIVE(float)) var0 =
+      uc_make_array_of_size<UC_PRIMITIVE(float)>(100000);
+    assert(UC_FUNCTION(sum)(var0) == UC_PRIMITIVE(float){});
+    assert(UC_FUNCTION(min)(var0) == UC_PRIMITIVE(float){});
+    assert(UC_FUNCTION(max)(var0) == UC_PRIMITIVE(float){});
+    assert(UC_FUNCTION(dot)(var0, var0) == UC_PRIMITIVE(float){});
+  }
+
+  void test_non_default_with_defaults() {
+  }
+
+  void test_non_default_with_non_defaults() {
+    UC_ARRAY(UC_PRIMITIVE(int)) var0 =
+      uc_make_array_of<UC_PRIMITIVE(int)>(3, -1, 4, 1, 5, 9, 2, 6, 5);
+    assert(UC_FUNCTION(sum)(var0) == 34);
+    assert(UC_FUNCTION(min)(var0) == -1);
+    assert(UC_FUNCTION(max)(var0) == 9);
+    assert(UC_FUNCTION(dot)(var0, var0) == 198);
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
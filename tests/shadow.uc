@@ -0,0 +1,40 @@
+// User functions of the same names as built-in functions shadow them.
+
+void main(string[] args)(float[] xs, float[] ys, int[] nums) {
+  xs = new float{1.0, 2.0, 3.0};
+  ys = new float{4.0, 5.0, 6.0};
+  axpy(2.0, xs, ys);
+  println("" + ys[0] + " " + ys[1] + " " + ys[2]);
+  ys = sqrt_all(ys);
+  println("" + ys.length + " " + ys[0]);
+
+  nums = new int{3, 1, 2};
+  sort(nums);
+  println("" + nums[0] + nums[1] + nums[2] + " " + sum(nums));
+}
+
+// Set y to a times x, ignoring the old value of y.
+void axpy(float a, float[] x, float[] y)(int i) {
+  for (i = 0; i < y.length; ++i) {
+    y[i] = a * x[i];
+  }
+}
+
+// Return the first element of an array.
+float[] sqrt_all(float[] x)() {
+  return new float{x[0]};
+}
+
+// Reverse an array.
+void sort(int[] nums)(int i, int tmp) {
+  for (i = 0; i < nums.length / 2; ++i) {
+    tmp = nums[i];
+    nums[i] = nums[nums.length - 1 - i];
+    nums[nums.length - 1 - i] = tmp;
+  }
+}
+
+// Return the number of elements of an array.
+int sum(int[] nums)() {
+  return nums.length;
+}
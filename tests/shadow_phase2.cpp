@@ -0,0 +1,24 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "shadow.cpp"
+
+  void test() {
+    UC_ARRAY(UC_PRIMITIVE(float)) var0 =
+      uc_make_array_of<UC_PRIMITIVE(float)>(1.0);
+    UC_FUNCTION(axpy)(2.0, var0, var0);
+    UC_FUNCTION(sort)(uc_make_array_of<UC_PRIMITIVE(int)>());
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
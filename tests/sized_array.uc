@@ -0,0 +1,39 @@
+void main(string[] args)(int[] counts, float[] weights, string[] names,
+                         cell[] cells, int[][] grid, int i, int j) {
+  counts = new int[args.length];
+  for (i = 0; i < args.length; ++i) {
+    counts[i] = string_to_int(args[i]);
+  }
+  println("" + counts.length + " " + counts[0] + " " + counts[3]);
+
+  weights = new float[3];
+  println("" + weights.length + " " + weights[2]);
+
+  names = new string[2];
+  println("[" + names[0] + "]" + names.length);
+
+  cells = new cell[2];
+  println(boolean_to_string(cells[1] == null));
+  cells[0] = new cell(1, 2);
+  println("" + cells[0].row + cells[0].col);
+
+  grid = new int[][3];
+  for (i = 0; i < grid.length; ++i) {
+    grid[i] = new int[i + 1];
+    for (j = 0; j < grid[i].length; ++j) {
+      grid[i][j] = i * j;
+    }
+  }
+  println("" + grid[2].length + " " + grid[2][2]);
+
+  counts = new int[0];
+  reserve(counts, 100);
+  println("" + counts.length);
+  for (i = 0; i < 100; ++i) {
+    counts << i;
+  }
+  reserve(counts, 10);
+  println("" + counts.length + " " + counts[99]);
+}
+
+struct cell(int row, int col);
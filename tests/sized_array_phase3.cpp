@@ -0,0 +1,51 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "sized_array.cpp"
+
+  void test_default() {
+    UC_REFERENCE(cell) var0 = uc_make_object<UC_REFERENCE(cell)>();
+    assert(var0->UC_VAR(row) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(col) == UC_PRIMITIVE(int){});
+    UC_ARRAY(UC_REFERENCE(cell)) var1 =
+      uc_make_array_of_size<UC_REFERENCE(cell)>(3);
+    assert(uc_length_field(var1) == 3);
+    assert(uc_array_index(var1, 2) == UC_REFERENCE(cell){});
+  }
+
+  void test_non_default_with_defaults() {
+    UC_REFERENCE(cell) var0 = uc_make_object<UC_REFERENCE(cell)>(UC_PRIMITIVE(int){},
+                                                                 UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(row) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(col) == UC_PRIMITIVE(int){});
+  }
+
+  void test_non_default_with_non_defaults() {
+    UC_PRIMITIVE(int) arg0_0 = 1;
+    UC_PRIMITIVE(int) arg0_1 = 2;
+    UC_REFERENCE(cell) var0 = uc_make_object<UC_REFERENCE(cell)>(arg0_0,
+                                                                 arg0_1);
+    assert(var0->UC_VAR(row) == arg0_0);
+    assert(var0->UC_VAR(col) == arg0_1);
+    UC_ARRAY(UC_REFERENCE(cell)) var1 =
+      uc_make_array_of_size<UC_REFERENCE(cell)>(2);
+    uc_array_index(var1, 0) = var0;
+    UC_FUNCTION(reserve)(var1, 50);
+    assert(uc_array_index(var1, 0) == var0);
+    assert(uc_length_field(var1) == 2);
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
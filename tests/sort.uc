@@ -0,0 +1,50 @@
+void main(string[] args)(int[] nums, float[] floats, string[] words,
+                         item[] items, int i) {
+  nums = new int{};
+  for (i = 0; i < args.length; ++i) {
+    nums << string_to_int(args[i]);
+  }
+  nums << 7 << -3 << 10;
+  sort(nums);
+  print_ints(nums);
+  println("" + binary_search(nums, 10) + " " + binary_search(nums, 4));
+
+  floats = new float{2.5, -1.0, 0.25, 2.0};
+  sort(floats);
+  println("" + floats[0] + " " + floats[3]);
+  println("" + binary_search(floats, 2));
+
+  floats = new float{2.5, sqrt(-1.0), -1.0, sqrt(-1.0), 0.25, 2.0};
+  sort(floats);
+  println("" + floats[0] + " " + floats[3] + " "
+          + boolean_to_string(floats[4] != floats[4]) + " "
+          + boolean_to_string(floats[5] != floats[5]));
+  println("" + binary_search(floats, 2) + " "
+          + binary_search(floats, 0.5));
+
+  words = new string{"pear", "apple", "fig", "banana"};
+  sort(words);
+  for (i = 0; i < words.length; ++i) {
+    println(words[i]);
+  }
+
+  items = new item{new item(2, "b"), null, new item(1, "z"),
+                   new item(2, "a")};
+  sort(items);
+  println(boolean_to_string(items[0] == null));
+  for (i = 1; i < items.length; ++i) {
+    println(items[i].key + items[i].name);
+  }
+  println("" + binary_search(items, new item(2, "b")));
+  println("" + binary_search(items, null));
+}
+
+void print_ints(int[] nums)(int i, string line) {
+  line = "";
+  for (i = 0; i < nums.length; ++i) {
+    line = line + nums[i] + " ";
+  }
+  println(line);
+}
+
+struct item(int key, string name);
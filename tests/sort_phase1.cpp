@@ -0,0 +1,18 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "sort.cpp"
+
+  void UC_CONCAT(UC_TYPEDEF(item), _test)(UC_REFERENCE(item));
+
+}
+
+int main() {
+  return 0;
+}
@@ -0,0 +1,22 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "sort.cpp"
+
+  void test() {
+    UC_FUNCTION(print_ints)(UC_ARRAY(UC_PRIMITIVE(int)){});
+    UC_FUNCTION(main)(UC_ARRAY(UC_PRIMITIVE(string)){});
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
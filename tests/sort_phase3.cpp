@@ -0,0 +1,55 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "sort.cpp"
+
+  void test_default() {
+    UC_REFERENCE(item) var0 = uc_make_object<UC_REFERENCE(item)>();
+    UC_REFERENCE(item) var0b = uc_make_object<UC_REFERENCE(item)>();
+    assert(var0 == var0b);
+    assert(!(var0 != var0b));
+    assert(!var0->uc_less(*var0b));
+    assert(var0->UC_VAR(key) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(name) == UC_PRIMITIVE(string){});
+  }
+
+  void test_non_default_with_defaults() {
+    UC_REFERENCE(item) var0 = uc_make_object<UC_REFERENCE(item)>(UC_PRIMITIVE(int){},
+                                                                 UC_PRIMITIVE(string){});
+    assert(var0->UC_VAR(key) == UC_PRIMITIVE(int){});
+    assert(var0->UC_VAR(name) == UC_PRIMITIVE(string){});
+  }
+
+  void test_non_default_with_non_defaults() {
+    UC_PRIMITIVE(int) arg0_0 = 1;
+    UC_PRIMITIVE(int) arg0_0c = 2;
+    UC_PRIMITIVE(string) arg0_1 = "foo3";
+    UC_PRIMITIVE(string) arg0_1c = "foo4";
+    UC_REFERENCE(item) var0 = uc_make_object<UC_REFERENCE(item)>(arg0_0,
+                                                                 arg0_1);
+    UC_REFERENCE(item) var0b = uc_make_object<UC_REFERENCE(item)>(arg0_0,
+                                                                  arg0_1c);
+    UC_REFERENCE(item) var0c = uc_make_object<UC_REFERENCE(item)>(arg0_0c,
+                                                                  arg0_1);
+    assert(var0 != var0b);
+    assert(var0->uc_less(*var0b));
+    assert(!var0b->uc_less(*var0));
+    assert(var0b->uc_less(*var0c));
+    assert(uc_less(UC_REFERENCE(item){}, var0));
+    assert(!uc_less(var0, UC_REFERENCE(item){}));
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
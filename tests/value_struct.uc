@@ -0,0 +1,61 @@
+void main(string[] args)(point p, point q, point[] path, segment s,
+                         segment t, map<point, string> names, int i,
+                         span w, span[] spans) {
+  p = new point(string_to_float(args[0]), string_to_float(args[1]));
+  q = p;
+  q.x = 1.5;
+  println("" + p.x + " " + q.x + " " + p.y);
+  println(boolean_to_string(p == q) + " " +
+          boolean_to_string(p == new point(20.0, 10.0)));
+
+  println("" + origin().x + " " + new point().y);
+
+  path = new point[3];
+  for (i = 0; i < path.length; ++i) {
+    path[i].x = i * 2;
+    path[i].y = -i;
+  }
+  path << new point(0.5, 7.0);
+  println("" + path[2].x + " " + path[3].y + " " + path.length);
+  sort(path);
+  println("" + path[0].x + " " + path[1].x + " " + path[3].x);
+
+  s = new segment(p, q, "first");
+  t = s;
+  t.end.y = 99.0;
+  println("" + s.end.y + " " + t.end.y + " " + t.label);
+  println(boolean_to_string(s == t));
+
+  names = new map<point, string>();
+  put(names, p, "p");
+  put(names, q, "q");
+  println(get(names, new point(20.0, 10.0)) + get(names, q) +
+          names.length);
+  println(boolean_to_string(contains(names, origin())));
+  println("" + length_of(s));
+
+  w = new span(1, 2, 3);
+  w.length = 5;
+  w.rows = 7;
+  spans = new span[2];
+  spans[1].length = 9;
+  spans[1].rows = spans[1].length + w.rows;
+  println("" + w.length + " " + w.rows + " " + spans[1].length + " " +
+          spans[1].rows + " " + spans[0].length);
+}
+
+point origin()() {
+  return new point();
+}
+
+float length_of(segment s)(float dx, float dy) {
+  dx = s.end.x - s.start.x;
+  dy = s.end.y - s.start.y;
+  return dx * dx + dy * dy;
+}
+
+value struct segment(point start, point end, string label);
+
+value struct point(float x, float y);
+
+value struct span(int start, int length, int rows);
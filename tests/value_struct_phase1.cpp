@@ -0,0 +1,19 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "value_struct.cpp"
+
+  void UC_CONCAT(UC_TYPEDEF(segment), _test)(UC_VALUE(segment));
+  void UC_CONCAT(UC_TYPEDEF(point), _test)(UC_VALUE(point));
+
+}
+
+int main() {
+  return 0;
+}
@@ -0,0 +1,25 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "value_struct.cpp"
+
+  void test() {
+    // value struct types are incomplete before phase 3
+    UC_VALUE(point) (*var0)() = UC_FUNCTION(origin);
+    UC_PRIMITIVE(float) (*var1)(UC_VALUE(segment)) = UC_FUNCTION(length_of);
+    assert(var0 && var1);
+    UC_FUNCTION(main)(UC_ARRAY(UC_PRIMITIVE(string)){});
+  }
+
+}
+
+int main() {
+  uc::test();
+  return 0;
+}
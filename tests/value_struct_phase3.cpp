@@ -0,0 +1,64 @@
+#include <cassert>
+#include "defs.h"
+#include "ref.h"
+#include "array.h"
+#include "library.h"
+#include "expr.h"
+
+namespace uc {
+
+  #include "value_struct.cpp"
+
+  void test_default() {
+    UC_VALUE(point) var0;
+    UC_VALUE(point) var0b;
+    assert(var0 == var0b);
+    assert(!(var0 != var0b));
+    assert(var0.UC_VAR(x) == UC_PRIMITIVE(float){});
+    assert(var0->UC_VAR(y) == UC_PRIMITIVE(float){});
+    assert(uc_hash(var0) == uc_hash(var0b));
+    UC_VALUE(segment) var1;
+    assert(var1.UC_VAR(start) == var0);
+    assert(var1.UC_VAR(end) == var0);
+    assert(var1.UC_VAR(label) == UC_PRIMITIVE(string){});
+  }
+
+  void test_non_default_with_defaults() {
+    UC_VALUE(point) var0 = UC_VALUE(point)(UC_PRIMITIVE(float){},
+                                           UC_PRIMITIVE(float){});
+    assert(var0 == UC_VALUE(point){});
+    UC_VALUE(segment) var1 = UC_VALUE(segment)(UC_VALUE(point){},
+                                               UC_VALUE(point){},
+                                               UC_PRIMITIVE(string){});
+    assert(var1 == UC_VALUE(segment){});
+  }
+
+  void test_non_default_with_non_defaults() {
+    UC_PRIMITIVE(float) arg0_0 = 1.5;
+    UC_PRIMITIVE(float) arg0_1 = 2.5;
+    UC_PRIMITIVE(string) arg1_2 = "foo3";
+    UC_VALUE(point) var0 = UC_VALUE(point)(arg0_0, arg0_1);
+    UC_VALUE(point) var0b = var0;
+    var0b->UC_VAR(y) = arg0_0;
+    assert(var0.UC_VAR(y) == arg0_1);
+    assert(var0 != var0b);
+    assert(uc_less(var0b, var0));
+    assert(!uc_less(var0, var0b));
+    UC_VALUE(segment) var1 = UC_VALUE(segment)(var0, var0b, arg1_2);
+    assert(var1.UC_VAR(start) == var0);
+    assert(var1.UC_VAR(end) == var0b);
+    assert(var1.UC_VAR(label) == arg1_2);
+    UC_ARRAY(UC_VALUE(point)) var2 =
+      uc_make_array_of<UC_VALUE(point)>(var0, var0b);
+    UC_FUNCTION(sort)(var2);
+    assert(uc_array_index(var2, 0) == var0b);
+  }
+
+}
+
+int main() {
+  uc::test_default();
+  uc::test_non_default_with_defaults();
+  uc::test_non_default_with_non_defaults();
+  return 0;
+}
@@ -9,39 +9,80 @@ Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
 # NOTE: This file is for the backend project. Ignore it for the
 #       frontend.
 
+import os
+
+import uccache
 import uccontext
+import ucemit
 
 
 ###################
 # Code Generation #
 ###################
 
-def gen_header(_, global_env, out):
+# the kinds of profiling that generated code can be instrumented for
+PROFILE_KINDS = ('time', 'alloc', 'refs')
+
+# the library included by generated code, which is the default for
+# the build rules of a split program
+LIB_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                       'include')
+
+# the flags that the build rules of a split program compile with by
+# default, as in the tests
+CXXFLAGS = '-g --std=c++17 -pedantic -pthread'
+
+
+def enable_profiling(kinds):
+    """Instrument generated code for the given kinds of profiling."""
+    enable_profiling.kinds = frozenset(kinds)
+
+
+enable_profiling.kinds = frozenset()
+
+
+def gen_header(tree, global_env, out):
     """Generate the header for a uC program, writing it to out.
 
     The header includes library code written in C++ and opens the uc
-    namespace.
+    namespace. A program that uses parallel constructs selects the
+    thread-safe build of the library by defining UC_THREADED, and each
+    kind of profiling is selected by defining UC_PROFILE_<KIND>.
     """
     ctx = uccontext.PhaseContext(0, global_env, out, '  ')
+    threaded = tree.parallel
+    if threaded:
+        ctx.print('#define UC_THREADED')
+    for kind in PROFILE_KINDS:
+        if kind in enable_profiling.kinds:
+            ctx.print(f'#define UC_PROFILE_{kind.upper()}')
+    if threaded or enable_profiling.kinds:
+        ctx.print()
     ctx.print('#include "defs.h"')
     ctx.print('#include "ref.h"')
     ctx.print('#include "array.h"')
+    ctx.print('#include "map.h"')
+    ctx.print('#include "parallel.h"')
+    ctx.print('#include "numeric.h"')
     ctx.print('#include "library.h"')
     ctx.print('#include "expr.h"')
+    if enable_profiling.kinds:
+        ctx.print('#include "profile.h"')
     ctx.print()
     ctx.print('namespace uc {\n')
-    ctx.indent = "  "
 
 
 def gen_footer(_, global_env, out):
     """Generate the footer for a uC program, writing it to out.
 
     The footer closes the uc namespace and bootstraps execution of a
-    uC program.
+    uC program. If the program is profiled, the profile is reported
+    once the uC main() returns.
     """
     ctx = uccontext.PhaseContext(0, global_env, out, '  ')
     ctx.print('} // namespace uc\n')
     ctx.print('int main(int argc, char **argv) {')
+    ctx.print('  std::ios::sync_with_stdio(false);')
     ctx.print('  uc::UC_ARRAY(uc::UC_PRIMITIVE(string)) args = ' +
               'uc::uc_make_array_of<uc::UC_PRIMITIVE(string)>();')
     ctx.print('  for (int i = 1; i < argc; i++) {')
@@ -49,14 +90,28 @@ def gen_footer(_, global_env, out):
               'uc::UC_PRIMITIVE(string)(argv[i]));')
     ctx.print('  }')
     ctx.print('  uc::UC_FUNCTION(main)(args);')
+    if enable_profiling.kinds:
+        ctx.print('  uc::uc_profile_report(argv[0]);')
     ctx.print('  return 0;')
     ctx.print('}')
 
 
+# the methods that generate each section of code, in phase order
+SECTION_METHODS = ('gen_type_decls', 'gen_function_decls',
+                   'gen_type_defs', 'gen_function_defs')
+
+# the comment that opens the section of code generated by each phase
+SECTION_HEADERS = (
+    '// Forward type declarations\n',
+    '// Forward function declarations\n',
+    '// Full type definitions\n',
+    '// Full function definitions\n',
+)
+
+
 def gen_type_decls(tree, global_env, out):
     """Generate forward type declarations, writing them to out."""
-    ctx = uccontext.PhaseContext(1, global_env, out, '  ')
-    ctx.print('// Forward type declarations\n', indent=True)
+    ctx = section_context(1, global_env, out)
     # add your code here
     tree.gen_type_decls(ctx)
     ctx.print()
@@ -64,8 +119,7 @@ def gen_type_decls(tree, global_env, out):
 
 def gen_function_decls(tree, global_env, out):
     """Generate forward function declarations, writing them to out."""
-    ctx = uccontext.PhaseContext(2, global_env, out, '  ')
-    ctx.print('// Forward function declarations\n', indent=True)
+    ctx = section_context(2, global_env, out)
     # add your code here
     tree.gen_function_decls(ctx)
     ctx.print()
@@ -73,16 +127,163 @@ def gen_function_decls(tree, global_env, out):
 
 def gen_type_defs(tree, global_env, out):
     """Generate full type definitions, writing them to out."""
-    ctx = uccontext.PhaseContext(3, global_env, out, '  ')
-    ctx.print('// Full type definitions\n', indent=True)
+    ctx = section_context(3, global_env, out)
     # add your code here
     tree.gen_type_defs(ctx)
 
 
 def gen_function_defs(tree, global_env, out):
     """Generate full function definitions, writing them to out."""
-    ctx = uccontext.PhaseContext(4, global_env, out, '  ')
-    ctx.print('// Full function definitions\n', indent=True)
+    ctx = section_context(4, global_env, out)
     # add your code here
+    keys = (uccache.decl_keys(tree, ctx['profile']) if uccache.enabled()
+            else None)
+    if keys is not None:
+        uccache.gen_function_defs(tree.decls, ctx, keys)
+    else:
+        tree.gen_function_defs(ctx)
+
+
+def gen_sections(tree, global_env, out, last_phase):
+    """Generate the code of phases 1 through last_phase, writing it to out.
+
+    Visits each declaration once, generating its code for every phase
+    into a separate section, rather than walking the whole tree once
+    per phase. The sections are then written to out in phase order,
+    so the output is the same as running the phases one after another.
+    """
+    contexts = [section_context(phase, global_env, ucemit.Emitter())
+                for phase in range(1, last_phase + 1)]
+    keys = (uccache.decl_keys(tree, enable_profiling.kinds)
+            if uccache.enabled() and last_phase >= 4 else None)
+    for decl in tree.decls:
+        for method, ctx in zip(SECTION_METHODS, contexts):
+            if ctx.phase == 4 and keys is not None:
+                uccache.gen_function_defs([decl], ctx, keys)
+            else:
+                getattr(decl, method)(ctx)
+    # the forward declarations are followed by an empty line
+    for ctx in contexts[:2]:
+        ctx.print()
+    for ctx in contexts:
+        out.extend(ctx.out)
+
+
+def section_context(phase, global_env, out):
+    """Return a context for generating the given phase's code to out.
+
+    Writes the comment that opens the phase's section of code.
+    """
+    if phase == 4:
+        ctx = function_defs_context(global_env, out)
+    else:
+        ctx = uccontext.PhaseContext(phase, global_env, out, '  ')
+    if phase == 3:
+        ctx['defined_types'] = set()
+    ctx.print(SECTION_HEADERS[phase - 1], indent=True)
+    return ctx
+
+
+def function_defs_context(global_env, out):
+    """Return a context for generating function definitions to out."""
+    ctx = uccontext.PhaseContext(4, global_env, out, '  ')
     ctx['nested'] = False
-    tree.gen_function_defs(ctx)
+    # whether the innermost loop is a parallel for
+    ctx['in_parallel_loop'] = False
+    ctx['profile'] = enable_profiling.kinds
+    return ctx
+
+
+#################
+# Split Program #
+#################
+
+def gen_split_header(tree, global_env, out):
+    """Generate the header shared by the files of a split program.
+
+    The header includes the library code and holds the forward type
+    and function declarations and full type definitions, so that
+    each source file can hold any of the function definitions.
+    """
+    gen_header(tree, global_env, out)
+    gen_sections(tree, global_env, out, 3)
+    uccontext.PhaseContext(0, global_env, out).print(
+        '} // namespace uc')
+
+
+def function_code(decls, global_env, keys):
+    """Return the function definitions generated for each of decls.
+
+    Cached code is reused if keys, the cache keys of the
+    declarations, are given.
+    """
+    ctx = function_defs_context(global_env, None)
+    codes = []
+    for decl in decls:
+        ctx.out = ucemit.Emitter()
+        if keys is not None:
+            uccache.gen_function_defs([decl], ctx, keys)
+        else:
+            decl.gen_function_defs(ctx)
+        codes.append(ctx.out.getvalue())
+    return codes
+
+
+def split_code(codes, num_files):
+    """Divide the code of consecutive declarations among files.
+
+    Returns a list of num_files lists, each holding a run of
+    consecutive codes, such that the files are about the same length.
+    A declaration goes to the file in which its middle falls.
+    """
+    total = max(sum(len(code) for code in codes), 1)
+    files = [[] for _ in range(num_files)]
+    done = 0
+    for code in codes:
+        index = (done + len(code) // 2) * num_files // total
+        files[min(index, num_files - 1)].append(code)
+        done += len(code)
+    return files
+
+
+def gen_split_source(header_name, codes, has_main, global_env, out):
+    """Generate a source file of a split program, writing it to out.
+
+    The file includes the header of the program and holds the given
+    function definitions. The file that has_main also holds the
+    footer that bootstraps execution of the program.
+    """
+    ctx = uccontext.PhaseContext(0, global_env, out, '  ')
+    ctx.print(f'#include "{header_name}"\n')
+    ctx.print('namespace uc {\n')
+    section_context(4, global_env, out)
+    for code in codes:
+        out.write(code)
+    if has_main:
+        gen_footer(None, global_env, out)
+    else:
+        ctx.print('} // namespace uc')
+
+
+def gen_build_rules(program, header, sources, out):
+    """Generate makefile rules that build a split program to out.
+
+    program is the name of the executable, header and sources the
+    names of the files that it is built from. Each source file is
+    compiled on its own, so that make -j compiles them in parallel.
+    The rules use CXX, CXXFLAGS, and LIB_DIR, so the file can be
+    included in another makefile that sets them.
+    """
+    ctx = uccontext.PhaseContext(0, None, out)
+    objects = [source[:-len('.cpp')] + '.o' for source in sources]
+    ctx.print(f'# Builds {program} from the code generated by ucc.py.')
+    ctx.print('# Run it with make -j -f, or include it in another '
+              'makefile.\n')
+    ctx.print(f'CXXFLAGS ?= {CXXFLAGS}')
+    ctx.print(f'LIB_DIR ?= {LIB_DIR}\n')
+    ctx.print(f'{program}: {" ".join(objects)}')
+    ctx.print('\t$(CXX) $(CXXFLAGS) -o $@ $^')
+    for source, obj in zip(sources, objects):
+        ctx.print()
+        ctx.print(f'{obj}: {source} {header}')
+        ctx.print('\t$(CXX) $(CXXFLAGS) -I$(LIB_DIR) -c -o $@ $<')
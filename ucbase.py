@@ -12,7 +12,7 @@ from dataclasses import dataclass
 import itertools
 import sys
 from typing import List, Optional, ClassVar, Iterator
-from ucerror import error
+from ucerror import error, set_phase
 import uctypes
 import ucfunctions
 
@@ -41,11 +41,261 @@ def ast_map(func, item, terminal_func=None):
         for i in item:
             ast_map(func, i, terminal_func)
     elif isinstance(item, ASTNode):
+        visit_count.visits += 1
         func(item)
     elif terminal_func:
         terminal_func(item)
 
 
+def visit_count():
+    """Return the number of AST nodes visited by tree walks so far."""
+    return visit_count.visits
+
+
+visit_count.visits = 0
+
+
+def reset_node_ids():
+    """Number the AST nodes created from now on from zero again.
+
+    Called before parsing each file when compiling several, so that
+    node ids, and the graphs written with them, do not depend on the
+    files compiled before.
+    """
+    ASTNode.next_id = itertools.count()
+
+
+def peek_node_id():
+    """Return the id of the next AST node created, without using it."""
+    node_id = next(ASTNode.next_id)
+    ASTNode.next_id = itertools.count(node_id)
+    return node_id
+
+
+# maps each AST node class to the names of its children
+_CHILD_SLOTS = {}
+
+# maps the name of a phase method to whether any AST node class
+# overrides it
+_ANY_OVERRIDES = {}
+
+# maps the name of a phase method to a dictionary that maps each AST
+# node class to its override of the method, or None if it inherits
+# the default from ASTNode
+_OVERRIDES = {}
+
+
+def child_slots(cls):
+    """Return the names of the children of the given AST node class.
+
+    The names are computed from the fields of the class the first time
+    they are requested.
+    """
+    slots = _CHILD_SLOTS.get(cls)
+    if slots is None:
+        slots = _CHILD_SLOTS[cls] = tuple(
+            field.name for field in dataclasses.fields(cls)[2:]
+            if field.default == dataclasses.MISSING
+        )
+    return slots
+
+
+def _override(cls, method):
+    """Return the given class's override of an ASTNode method, if any."""
+    overrides = _OVERRIDES.setdefault(method, {})
+    if cls not in overrides:
+        func = getattr(cls, method)
+        overrides[cls] = (None if func is getattr(ASTNode, method)
+                          else func)
+    return overrides[cls]
+
+
+def _overridden_anywhere(method):
+    """Return whether any AST node class overrides an ASTNode method.
+
+    A phase that no class overrides does nothing, so its walk can be
+    skipped.
+    """
+    if method not in _ANY_OVERRIDES:
+        classes = ASTNode.__subclasses__()
+        found = False
+        while classes and not found:
+            cls = classes.pop()
+            classes.extend(cls.__subclasses__())
+            found = method in cls.__dict__
+        _ANY_OVERRIDES[method] = found
+    return _ANY_OVERRIDES[method]
+
+
+def _collect_nodes(items, nodes):
+    """Append the AST nodes in a (possibly nested) list to nodes."""
+    for item in items:
+        if isinstance(item, ASTNode):
+            nodes.append(item)
+        elif isinstance(item, list):
+            _collect_nodes(item, nodes)
+
+
+def _push_children(node, stack):
+    """Push the children of an AST node onto a stack.
+
+    The children are pushed in reverse, so that the first child is
+    popped first.
+    """
+    children = []
+    for name in child_slots(type(node)):
+        child = getattr(node, name)
+        if isinstance(child, ASTNode):
+            children.append(child)
+        elif isinstance(child, list):
+            _collect_nodes(child, children)
+    stack.extend(reversed(children))
+
+
+class _PhaseSet:
+    """A set of phases that a fused walk runs together.
+
+    phases is a tuple of (method, ctx) pairs in phase order. A phase
+    set caches how the phases divide between those that each class
+    overrides and those that it inherits, so that the nodes in a
+    subtree, which share a phase set, pay for the division only once
+    per class.
+    """
+
+    __slots__ = ('phases', 'splits', 'merged')
+
+    def __init__(self, phases):
+        """Initialize this set with the given (method, ctx) pairs."""
+        self.phases = tuple(phases)
+        # maps each class to the (func, ctx) pairs of the phases it
+        # overrides, and the phase set of those it inherits (or None)
+        self.splits = {}
+        # maps a method to a (ctx, phase set) pair of this set
+        # extended with the method run with ctx
+        self.merged = {}
+
+    def split(self, cls):
+        """Return the overridden and inherited phases of a class."""
+        called = []
+        inherited = []
+        for method, ctx in self.phases:
+            func = _override(cls, method)
+            if func is None:
+                inherited.append((method, ctx))
+            else:
+                called.append((func, ctx))
+        if not called:
+            result = ((), self)
+        else:
+            result = (tuple(called),
+                      _PhaseSet(inherited) if inherited else None)
+        self.splits[cls] = result
+        return result
+
+    def merge(self, method, ctx):
+        """Return this set extended with the given method and ctx."""
+        entry = self.merged.get(method)
+        if entry is None or entry[0] is not ctx:
+            phases = sorted(self.phases + ((method, ctx),),
+                            key=lambda phase: phase[1].phase)
+            entry = self.merged[method] = (ctx, _PhaseSet(phases))
+        return entry[1]
+
+
+# maps the id of a node in a fused walk to the set of phases that
+# the node's class inherits from ASTNode; these join the first walk
+# of its children made by a phase that it overrides
+_RIDERS = {}
+
+
+def walk_phases(node, phases):
+    """Run several phases on an AST subtree in a single walk.
+
+    phases is a list of (method, ctx) pairs in phase order. Each node
+    is visited once for all of the phases that its class inherits
+    from ASTNode. The methods that it overrides are called in phase
+    order, and the inherited phases join the walk of its children
+    made by the first of them, or walk its children afterward if
+    none does. The phases must not depend on each other's results
+    within the subtree. Phases that no class overrides are skipped.
+    The running phase is set in ucerror around each call, so that
+    errors can be held by phase.
+    """
+    phases = [phase for phase in phases if _overridden_anywhere(phase[0])]
+    if len(phases) == 1:
+        method, ctx = phases[0]
+        previous = set_phase(ctx.phase)
+        visit_count.visits += 1
+        getattr(node, method)(ctx)
+        set_phase(previous)
+    elif phases:
+        _walk_fused([(node, _PhaseSet(phases))])
+
+
+def _walk_fused(stack):
+    """Run a fused walk on a stack of (node, phase set) pairs."""
+    visits = 0
+    while stack:
+        node, phase_set = stack.pop()
+        visits += 1
+        cls = type(node)
+        split = phase_set.splits.get(cls)
+        called, inherited = split if split else phase_set.split(cls)
+        if called:
+            key = id(node)
+            if inherited:
+                _RIDERS[key] = inherited
+            for func, ctx in called:
+                if error.phase == ctx.phase:
+                    func(node, ctx)
+                else:
+                    previous = set_phase(ctx.phase)
+                    func(node, ctx)
+                    set_phase(previous)
+            inherited = _RIDERS.pop(key, None)
+            if not inherited:
+                continue
+        children = []
+        _push_children(node, children)
+        stack.extend((child, inherited) for child in children)
+    visit_count.visits += visits
+
+
+def walk_children(node, method, ctx):
+    """Call the named phase method on each child of an AST node.
+
+    The walk is iterative: a node whose class inherits the method
+    from ASTNode would only pass the call on to its own children, so
+    they are pushed onto the walk's stack instead. The method is
+    called only on nodes that override it, and they are responsible
+    for their own subtrees. If the node is in a fused walk, the
+    phases it inherits join this walk (see walk_phases).
+    """
+    if _RIDERS and id(node) in _RIDERS:
+        phase_set = _RIDERS.pop(id(node)).merge(method, ctx)
+        children = []
+        _push_children(node, children)
+        _walk_fused([(child, phase_set) for child in children])
+        return
+    if not _overridden_anywhere(method):
+        return
+    overrides = _OVERRIDES.setdefault(method, {})
+    stack = []
+    _push_children(node, stack)
+    visits = 0
+    while stack:
+        child = stack.pop()
+        visits += 1
+        cls = type(child)
+        func = overrides[cls] if cls in overrides else _override(cls,
+                                                                  method)
+        if func is None:
+            _push_children(child, stack)
+        else:
+            func(child, ctx)
+    visit_count.visits += visits
+
+
 ################################
 # Environments in the Compiler #
 ################################
@@ -74,6 +324,8 @@ class GlobalEnv:
         """
         if name in self.types:
             error(phase, position, 'redefinition of type ' + name)
+        elif declnode.is_value:
+            self.types[name] = uctypes.ValueType(name, declnode)
         else:
             self.types[name] = uctypes.UserType(name, declnode)
         return self.types[name]
@@ -85,9 +337,11 @@ class GlobalEnv:
         position of the function declaration, name is a string
         containing the name of the function, and declnode is the AST
         node corresponding to the declaration. Reports an error if a
-        function of the given name is already defined.
+        function of the given name is already defined, unless it is a
+        generic built-in function, which the new function shadows.
         """
-        if name in self.functions:
+        if name in self.functions and not isinstance(
+                self.functions[name], ucfunctions.GenericFunction):
             error(phase, position, 'redefinition of function ' + name)
         else:
             self.functions[name] = ucfunctions.UserFunction(name,
@@ -210,14 +464,12 @@ class ASTNode:
     @property
     def children(self):
         """Return the children of this AST node."""
-        return [self.__getattribute__(field)
-                for field in self.child_names]
+        return [getattr(self, field) for field in child_slots(type(self))]
 
     @property
     def child_names(self):
         """Return the names of the children of this AST node."""
-        return [field.name for field in dataclasses.fields(self)[2:]
-                if field.default == dataclasses.MISSING]
+        return child_slots(type(self))
 
     def __str__(self):
         """Return a string representation of this and its children."""
@@ -232,7 +484,7 @@ class ASTNode:
         Adds the types and functions that are found to ctx.global_env.
         Reports an error if a type or function is multiply defined.
         """
-        ast_map(lambda n: n.find_decls(ctx), self.children)
+        walk_children(self, 'find_decls', ctx)
 
     def resolve_types(self, ctx):
         """Resolve type names to the actual types they name.
@@ -240,7 +492,7 @@ class ASTNode:
         Uses ctx.global_env to look up a type name. Reports
         an error if an unknown type is named.
         """
-        ast_map(lambda n: n.resolve_types(ctx), self.children)
+        walk_children(self, 'resolve_types', ctx)
 
     def resolve_calls(self, ctx):
         """Match function calls to the actual functions they name.
@@ -248,7 +500,7 @@ class ASTNode:
         Uses ctx.global_env to look up a function name. Reports an
         error if an unknown function is named.
         """
-        ast_map(lambda n: n.resolve_calls(ctx), self.children)
+        walk_children(self, 'resolve_calls', ctx)
 
     def check_names(self, ctx):
         """Check names in types and functions for uniqueness.
@@ -257,11 +509,11 @@ class ASTNode:
         ensure they are unique in the scope of the type or
         function.
         """
-        ast_map(lambda n: n.check_names(ctx), self.children)
+        walk_children(self, 'check_names', ctx)
 
     def basic_control(self, ctx):
         """Check basic control flow within this AST node."""
-        ast_map(lambda n: n.basic_control(ctx), self.children)
+        walk_children(self, 'basic_control', ctx)
 
     def type_check(self, ctx):
         """Compute the type of each expression.
@@ -270,11 +522,11 @@ class ASTNode:
         Checks that the type of an expression is compatible with the
         context in which it is used.
         """
-        ast_map(lambda n: n.type_check(ctx), self.children)
+        walk_children(self, 'type_check', ctx)
 
     def advanced_control(self, ctx):
         """Check advanced control flow within this AST node."""
-        ast_map(lambda n: n.advanced_control(ctx), self.children)
+        walk_children(self, 'advanced_control', ctx)
 
     def write_types(self, ctx):
         """Write out a representation of this AST to ctx.out.
@@ -288,27 +540,26 @@ class ASTNode:
                                      node_type else node_type),
                       end='')
         ctx.print(' {')
-        new_ctx = ctx.clone()
-        new_ctx.indent += '  '
+        new_ctx = ctx.indented()
         ast_map(lambda n: n.write_types(new_ctx), self.children,
                 lambda s: new_ctx.print(s, indent=True))
         ctx.print('}', indent=True)
 
     def gen_type_decls(self, ctx):
         """Generate type decls."""
-        ast_map(lambda n: n.gen_type_decls(ctx), self.children)
+        walk_children(self, 'gen_type_decls', ctx)
 
     def gen_function_decls(self, ctx):
         """Generate function decls."""
-        ast_map(lambda n: n.gen_function_decls(ctx), self.children)
+        walk_children(self, 'gen_function_decls', ctx)
 
     def gen_type_defs(self, ctx):
         """Generate type defs."""
-        ast_map(lambda n: n.gen_type_defs(ctx), self.children)
+        walk_children(self, 'gen_type_defs', ctx)
 
     def gen_function_defs(self, ctx):
         """Generate function defs."""
-        ast_map(lambda n: n.gen_function_defs(ctx), self.children)
+        walk_children(self, 'gen_function_defs', ctx)
 
 ##############
 # Start Node #
@@ -322,9 +573,14 @@ class DeclNode(ASTNode):
 
 @dataclass
 class ProgramNode(ASTNode):
-    """Represents a uC program."""
+    """Represents a uC program.
+
+    parallel is whether the program contains a parallel construct,
+    which is recorded by the parser.
+    """
 
     decls: List[DeclNode]
+    parallel: bool = attribute()
 
 
 ##########################
@@ -396,6 +652,46 @@ class ArrayTypeNameNode(BaseTypeNameNode):
         self.type = self.elem_type.type.array_type
 
 
+@dataclass
+class MatrixTypeNameNode(BaseTypeNameNode):
+    """An AST node representing a matrix type.
+
+    elem_type is a node representing the element type.
+    """
+
+    elem_type: BaseTypeNameNode
+
+    def resolve_types(self, ctx):
+        """Resolve type names to the actual types they name.
+
+        Uses ctx.global_env to look up a type name. Reports
+        an error if an unknown type is named.
+        """
+        super().resolve_types(ctx)
+        self.type = self.elem_type.type.matrix_type
+
+
+@dataclass
+class MapTypeNameNode(BaseTypeNameNode):
+    """An AST node representing a map type.
+
+    key_type is a node representing the key type and value_type is a
+    node representing the value type.
+    """
+
+    key_type: BaseTypeNameNode
+    value_type: BaseTypeNameNode
+
+    def resolve_types(self, ctx):
+        """Resolve type names to the actual types they name.
+
+        Uses ctx.global_env to look up a type name. Reports
+        an error if an unknown type is named.
+        """
+        super().resolve_types(ctx)
+        self.type = self.key_type.type.map_type(self.value_type.type)
+
+
 @dataclass
 class VarDeclNode(ASTNode):
     """An AST node representing a variable or field declaration.
@@ -429,12 +725,14 @@ class StructDeclNode(DeclNode):
     """An AST node representing a type declaration.
 
     name is the name of the type and vardecls is a list of field
-    declarations. type is the instance of uctypes.Type that is
-    associated with this declaration.
+    declarations. is_value is whether this is a value struct. type is
+    the instance of uctypes.Type that is associated with this
+    declaration.
     """
 
     name: NameNode
     vardecls: List[VarDeclNode]
+    is_value: bool = False
     type: Optional[uctypes.Type] = attribute()
     localenv: Optional[VarEnv] = attribute()
 
@@ -473,6 +771,27 @@ class StructDeclNode(DeclNode):
         new_ctx = ctx.clone()
         new_ctx['local_env'] = self.localenv
         super().type_check(new_ctx)
+        if self.is_value and self.contains_value(self.type, set()):
+            error(6, self.position,
+                  f"value struct {self.name.raw} cannot contain itself")
+
+    def contains_value(self, value_type, visited):
+        """Return whether this struct stores the given value type inline.
+
+        Follows fields of value type transitively, skipping the types
+        in visited.
+        """
+        for var in self.vardecls:
+            field_type = var.vartype.type
+            if not isinstance(field_type, uctypes.ValueType):
+                continue
+            if field_type is value_type:
+                return True
+            if field_type not in visited:
+                visited.add(field_type)
+                if field_type.decl.contains_value(value_type, visited):
+                    return True
+        return False
 
     def gen_type_decls(self, ctx):
         """Generate type decls."""
@@ -480,16 +799,31 @@ class StructDeclNode(DeclNode):
 
     def gen_type_defs(self, ctx):
         """Generate type defs."""
+        if self.name.raw in ctx['defined_types']:
+            return
+        ctx['defined_types'].add(self.name.raw)
+
+        # value struct fields must be complete types, so define their
+        # types first
+        for var in self.vardecls:
+            if isinstance(var.vartype.type, uctypes.ValueType):
+                var.vartype.type.decl.gen_type_defs(ctx)
+
         # name
         ctx.print(f"struct UC_TYPEDEF({self.name.raw})", indent=True, end="")
         ctx.print(" {")
+        with ctx.nested():
+            self.gen_members(ctx)
+        ctx.print("};\n", indent=True)
 
-        # variable declarations
-        ctx.indent += "  "
+    def gen_members(self, ctx):
+        """Generate the members of this type's definition."""
+        # variable declarations, default initialized in a value struct
+        init = "{}" if self.is_value else ""
         for var in self.vardecls:
             ctx.print(
                 f"{var.vartype.type.mangle()} "
-                + f"UC_VAR({var.name.raw});", indent=True)
+                + f"UC_VAR({var.name.raw}){init};", indent=True)
 
         # defualt constructor
         ctx.print(f"UC_TYPEDEF({self.name.raw})() = default;", indent=True)
@@ -504,10 +838,10 @@ class StructDeclNode(DeclNode):
                 if i != len(self.vardecls)-1:
                     ctx.print(", ", end="")
             ctx.print(") {")
-            ctx.indent += "  "
-            for i, var in enumerate(self.vardecls):
-                ctx.print(f"UC_VAR({var.name.raw}) = var{i};", indent=True)
-            ctx.indent = "    "
+            with ctx.nested():
+                for i, var in enumerate(self.vardecls):
+                    ctx.print(f"UC_VAR({var.name.raw}) = var{i};",
+                              indent=True)
             ctx.print("}", indent=True)
 
         # overloaded == operator
@@ -516,18 +850,17 @@ class StructDeclNode(DeclNode):
             + f"(const UC_TYPEDEF({self.name.raw}) &rhs)"
             + " const", indent=True, end="")
         ctx.print(" {")
-        ctx.indent += "  "
-        ctx.print("return ", indent=True, end="")
-        if len(self.vardecls) == 0:
-            ctx.print("true", end="")
-        for i, var in enumerate(self.vardecls):
-            ctx.print(
-                f"UC_VAR({var.name.raw})"
-                + f" == rhs.UC_VAR({var.name.raw})", end="")
-            if i != len(self.vardecls)-1:
-                ctx.print(" && ", end="")
-        ctx.print(";")
-        ctx.indent = "    "
+        with ctx.nested():
+            ctx.print("return ", indent=True, end="")
+            if len(self.vardecls) == 0:
+                ctx.print("true", end="")
+            for i, var in enumerate(self.vardecls):
+                ctx.print(
+                    f"UC_VAR({var.name.raw})"
+                    + f" == rhs.UC_VAR({var.name.raw})", end="")
+                if i != len(self.vardecls)-1:
+                    ctx.print(" && ", end="")
+            ctx.print(";")
         ctx.print("}", indent=True)
 
         # overloaded != operator
@@ -536,12 +869,52 @@ class StructDeclNode(DeclNode):
             + f"(const UC_TYPEDEF({self.name.raw}) "
             + "&rhs) const", indent=True, end="")
         ctx.print(" {")
-        ctx.indent += "  "
-        ctx.print("return !((*this)==rhs);", indent=True)
-        ctx.indent = "    "
+        with ctx.nested():
+            ctx.print("return !((*this)==rhs);", indent=True)
+        ctx.print("}", indent=True)
+
+        # hash consistent with ==, used by the map built-in type
+        ctx.print("std::size_t uc_hash() const", indent=True, end="")
+        ctx.print(" {")
+        with ctx.nested():
+            ctx.print("std::size_t hash = 0;", indent=True)
+            for var in self.vardecls:
+                ctx.print("hash = uc_hash_combine(hash, "
+                          + f"uc::uc_hash(UC_VAR({var.name.raw})));",
+                          indent=True)
+            ctx.print("return hash;", indent=True)
         ctx.print("}", indent=True)
-        ctx.indent = "  "
-        ctx.print("};\n", indent=True)
+
+        # field-wise ordering, used by the sort() built-in
+        if uctypes.is_ordered_type(self.type):
+            ctx.print(
+                "UC_PRIMITIVE(boolean) uc_less"
+                + f"(const UC_TYPEDEF({self.name.raw}) "
+                + "&rhs) const", indent=True, end="")
+            ctx.print(" {")
+            with ctx.nested():
+                for var in self.vardecls:
+                    field = f"UC_VAR({var.name.raw})"
+                    ctx.print(f"if (uc::uc_less({field}, rhs.{field})) "
+                              + "return true;", indent=True)
+                    ctx.print(f"if (uc::uc_less(rhs.{field}, {field})) "
+                              + "return false;", indent=True)
+                ctx.print("return false;", indent=True)
+            ctx.print("}", indent=True)
+
+        # member access on a value struct uses the same -> syntax as
+        # on a reference
+        if self.is_value:
+            ctx.print(f"UC_TYPEDEF({self.name.raw}) *operator->() "
+                      + "{ return this; }", indent=True)
+            ctx.print(f"const UC_TYPEDEF({self.name.raw}) *operator->() "
+                      + "const { return this; }", indent=True)
+
+    def gen_function_decls(self, ctx):
+        """Generate function decls, of which a struct has none."""
+
+    def gen_function_defs(self, ctx):
+        """Generate function defs, of which a struct has none."""
 
 
 @ dataclass
@@ -620,15 +993,23 @@ class FunctionDeclNode(DeclNode):
         new_ctx['rettype'] = self.func.rettype
         super().type_check(new_ctx)
 
+    def gen_type_decls(self, ctx):
+        """Generate type decls, of which a function has none.
+
+        Types are only declared at the top level, so the body is not
+        walked.
+        """
+
+    def gen_type_defs(self, ctx):
+        """Generate type defs, of which a function has none."""
+
     def gen_function_decls(self, ctx):
         """Generate function decls."""
         # return type
         ctx.print(self.func.rettype.mangle(), indent=True)
 
         # function name
-        new_ctx = ctx.clone()
-        new_ctx.indent += "  "
-        new_ctx.print(self.func.mangle(), indent=True, end="")
+        ctx.indented().print(self.func.mangle(), indent=True, end="")
 
         # function parameters
         ctx.print("(", end="")
@@ -646,8 +1027,7 @@ class FunctionDeclNode(DeclNode):
         ctx.print(self.func.rettype.mangle(), indent=True)
 
         # function name
-        ctx.indent += "  "
-        ctx.print(self.func.mangle(), indent=True, end="")
+        ctx.indented().print(self.func.mangle(), indent=True, end="")
 
         # function parameters
         ctx.print("(", end="")
@@ -660,15 +1040,19 @@ class FunctionDeclNode(DeclNode):
         ctx.print(") {")
 
         # local variable declarations
-        ctx.indent += "  "
+        body_ctx = ctx.indented(2)
         for var in self.vardecls:
-            ctx.print(
+            body_ctx.print(
                 f"{var.vartype.type.mangle()}"
                 + f" UC_VAR({var.name.raw});", indent=True)
 
-        super().gen_function_defs(ctx)
+        body_ctx['function_name'] = self.name.raw
+        if body_ctx['profile'] & {'time', 'refs'}:
+            body_ctx.print(f'UC_PROFILE_FUNCTION("{self.name.raw}", '
+                           + f'{self.position});', indent=True)
+
+        super().gen_function_defs(body_ctx)
 
-        ctx.indent = "  "
         ctx.print("}", indent=True)
 
 
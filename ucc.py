@@ -8,11 +8,57 @@ Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
 
 import sys
 import argparse
+import contextlib
+import json
+import os
+import time
+import tracemalloc
 import ucbase
 import ucerror
 import ucparser
 import ucfrontend
 import ucbackend
+import uccache
+import ucemit
+import ucworkers
+
+# frontend phases, with the message printed before each is run
+FRONTEND_PHASES = (
+    (ucfrontend.find_decls, 'Finding declarations...'),
+    (ucfrontend.resolve_types, 'Resolving types...'),
+    (ucfrontend.resolve_calls, 'Resolving function calls...'),
+    (ucfrontend.check_names, 'Checking field and variable names...'),
+    (ucfrontend.basic_control, 'Checking basic control flow...'),
+    (ucfrontend.type_check, 'Type checking...'),
+    (ucfrontend.advanced_control, 'Checking advanced control flow...'),
+)
+
+# backend phases, which are preceded by gen_header and followed by
+# gen_footer when generating a complete program
+BACKEND_PHASES = (
+    ucbackend.gen_type_decls,
+    ucbackend.gen_function_decls,
+    ucbackend.gen_type_defs,
+    ucbackend.gen_function_defs
+)
+
+
+class CompileError(Exception):
+    """Raised when errors are detected in a source file."""
+
+
+class ArgumentParser(argparse.ArgumentParser):
+    """A parser of command-line arguments that may be read from files.
+
+    Each line of an @FILE holds one argument, with surrounding
+    whitespace removed. Blank lines and lines starting with # are
+    skipped.
+    """
+
+    def convert_arg_line_to_args(self, arg_line):
+        """Return the arguments on a line of an @FILE."""
+        arg = arg_line.strip()
+        return [arg] if arg and not arg.startswith('#') else []
 
 
 def uc_compile(filename, analyze_only, write_types, write_graph,
@@ -45,30 +91,40 @@ def uc_frontend(filename, write_types, write_graph, frontend_phase):
     tool to an output file. Returns the resulting AST and global
     environment.
     """
-    tree = ucparser.parse(filename)
+    tree = run_phase('parse', ucparser.parse, filename)
     check_errors(ucparser.error_count(), 0)
     global_env = ucfrontend.make_global_env()
-    phases = (
-        (ucfrontend.find_decls, 'Finding declarations...'),
-        (ucfrontend.resolve_types, 'Resolving types...'),
-        (ucfrontend.resolve_calls, 'Resolving function calls...'),
-        (ucfrontend.check_names, 'Checking field and variable names...'),
-        (ucfrontend.basic_control, 'Checking basic control flow...'),
-        (ucfrontend.type_check, 'Type checking...'),
-        (ucfrontend.advanced_control, 'Checking advanced control flow...'),
-    )
     if not frontend_phase:
-        frontend_phase = len(phases)
-    for i, phase in enumerate(phases[:frontend_phase]):
+        frontend_phase = len(FRONTEND_PHASES)
+    # the first two phases always walk the whole program, since later
+    # phases need every declaration and its types
+    fused = uc_frontend.pipeline and frontend_phase > 2
+    for i, phase in enumerate(FRONTEND_PHASES[:2 if fused
+                                              else frontend_phase]):
         print(phase[1])
-        phase[0](tree, global_env)
+        run_phase(phase[0].__name__, phase[0], tree, global_env)
         check_errors(ucerror.error_count(), i + 1)
+    if fused:
+        # the AST is written out with the results of the phases, which
+        # worker processes do not return
+        if ucworkers.enabled() and not (write_types or write_graph):
+            run_phase('check_decls', ucworkers.check_decls, tree,
+                      global_env, frontend_phase)
+        else:
+            run_phase('check_decls', ucfrontend.check_decls, tree,
+                      global_env, frontend_phase)
+        for i, phase in enumerate(FRONTEND_PHASES[2:frontend_phase], 3):
+            print(phase[1])
+            check_errors(ucerror.flush_errors(i), i)
+        ucerror.unbuffer_errors()
     if write_types:
         print('Writing types...')
         outname = (filename[:-3] if filename.endswith('.uc')
                    else filename) + '.types'
-        with open(outname, 'w') as out:
+        with open(outname, 'w') as stream:
+            out = ucemit.Emitter(stream)
             ucfrontend.write_types(tree, global_env, out)
+            out.flush()
         print('Wrote types to {0}.'.format(outname))
     if write_graph:
         print('Writing graph...')
@@ -80,13 +136,94 @@ def uc_frontend(filename, write_types, write_graph, frontend_phase):
     return tree, global_env
 
 
+uc_frontend.pipeline = True
+
+
+def disable_pipeline():
+    """Run each compiler phase as a separate walk of the whole AST.
+
+    By default, frontend phases 3 and later are run together on each
+    declaration, as described in ucfrontend.check_decls(), and the
+    backend phases are run together on each declaration, as described
+    in ucbackend.gen_sections().
+    """
+    uc_frontend.pipeline = False
+    uc_backend.pipeline = False
+
+
 def check_errors(num_errors, phase):
-    """Report number of errors and Exit if num_errors is non-zero."""
+    """Report number of errors and stop if num_errors is non-zero.
+
+    Stops compiling the current file by raising CompileError.
+    """
     if num_errors:
         msg = '{0} error{1} generated in phase {2}.'
         print(msg.format(num_errors, 's' if num_errors != 1 else '',
                          phase))
-        sys.exit(1)
+        raise CompileError(phase)
+
+
+def compile_file(filename, args):
+    """Compile the given file with the command-line options in args.
+
+    The lexer, parser, and options are shared by all the files
+    compiled by this process, but the errors, AST node ids, and time
+    report of each file start over. If the cache is enabled and the
+    file was compiled before with the same options, its results are
+    restored instead. Returns whether the file was compiled without
+    errors.
+    """
+    ucerror.reset_errors()
+    ucbase.reset_node_ids()
+    if run_phase.records is not None:
+        run_phase.records = []
+    if len(args.filenames) > 1:
+        print('Compiling {0}...'.format(filename))
+    key = (uccache.file_key(filename, cache_options(args))
+           if uccache.enabled() else None)
+    if not (key and run_phase('restore_cached', uccache.restore_file,
+                              key)):
+        recording = (uccache.recording_output() if key
+                     else contextlib.nullcontext())
+        try:
+            with recording as output:
+                uc_compile(filename, args.analyze_only, args.write_types,
+                           args.write_graph, args.frontend_phase,
+                           args.backend_phase)
+        except CompileError:
+            # failed compiles are not cached
+            return False
+        if key:
+            uccache.store_file(key, output.getvalue(),
+                               output_files(filename, args))
+    if run_phase.records is not None:
+        write_time_report(filename, args.time_report_json)
+    return True
+
+
+def cache_options(args):
+    """Return the options in args that affect the compiler's output."""
+    return [args.analyze_only, args.write_types, args.write_graph,
+            args.frontend_phase, args.backend_phase, args.no_errors,
+            sorted(ucbackend.enable_profiling.kinds), args.split]
+
+
+def output_files(filename, args):
+    """Return the files written by compiling filename with args."""
+    base = filename[:-3] if filename.endswith('.uc') else filename
+    names = []
+    if args.write_types:
+        names.append(base + '.types')
+    if args.write_graph:
+        names.append(base + '.dot')
+    if args.analyze_only:
+        return names
+    if args.split:
+        header, sources, rules = split_names(filename, args.split)
+        names += [header] + sources + [rules]
+    else:
+        names.append(base + '.cpp')
+    return names
 
 
 def uc_backend(filename, tree, global_env, backend_phase):
@@ -94,32 +231,183 @@ def uc_backend(filename, tree, global_env, backend_phase):
 
     Writes generated code to an output file (backed project only).
     """
+    if uc_backend.split:
+        uc_split_backend(filename, tree, global_env, uc_backend.split)
+        return
     outname = (filename[:-3] if filename.endswith('.uc')
                else filename) + '.cpp'
-    phases = (
-        ucbackend.gen_type_decls,
-        ucbackend.gen_function_decls,
-        ucbackend.gen_type_defs,
-        ucbackend.gen_function_defs
-    )
+    phases = BACKEND_PHASES
+    if ucworkers.enabled():
+        phases = phases[:-1] + (ucworkers.gen_function_defs,)
+    last_phase = backend_phase or len(phases)
     print('Generating code...')
-    with open(outname, 'w') as out:
+    with open(outname, 'w') as stream:
+        out = ucemit.Emitter(stream)
         if not backend_phase:
-            ucbackend.gen_header(tree, global_env, out)
-        for phase in (phases[:backend_phase]
-                      if backend_phase else phases):
-            phase(tree, global_env, out)
+            run_phase('gen_header', ucbackend.gen_header, tree,
+                      global_env, out)
+        fused = 0
+        if uc_backend.pipeline:
+            # worker processes generate the function definitions on
+            # their own, after the other sections
+            fused = (min(last_phase, len(phases) - 1)
+                     if ucworkers.enabled() else last_phase)
+            run_phase('gen_sections', ucbackend.gen_sections, tree,
+                      global_env, out, fused)
+        for phase in phases[fused:last_phase]:
+            run_phase(phase.__name__, phase, tree, global_env, out)
         if not backend_phase:
-            ucbackend.gen_footer(tree, global_env, out)
+            run_phase('gen_footer', ucbackend.gen_footer, tree,
+                      global_env, out)
+        out.flush()
     print('Wrote code to {0}.'.format(outname))
 
 
+uc_backend.pipeline = True
+uc_backend.split = None
+
+
+def split_output(num_files):
+    """Divide the generated code of a program among source files.
+
+    The header and footer and the declarations and definitions of
+    types and functions go in a shared header, and the function
+    definitions are divided among num_files source files.
+    """
+    uc_backend.split = num_files
+
+
+def split_names(filename, num_files):
+    """Return the names of the files written for a split program.
+
+    These are the header, the list of source files, and the makefile
+    fragment that builds them.
+    """
+    base = filename[:-3] if filename.endswith('.uc') else filename
+    return (base + '_decls.h',
+            [f'{base}_{i}.cpp' for i in range(1, num_files + 1)],
+            base + '.mk')
+
+
+def uc_split_backend(filename, tree, global_env, num_files):
+    """Run the uC compiler backend, splitting the code among files.
+
+    Writes the header and num_files source files named by
+    split_names(), and build rules for an executable to the makefile
+    fragment.
+    """
+    header, sources, rules = split_names(filename, num_files)
+    print('Generating code...')
+    with open(header, 'w') as stream:
+        out = ucemit.Emitter(stream)
+        run_phase('gen_split_header', ucbackend.gen_split_header, tree,
+                  global_env, out)
+        out.flush()
+    keys = (uccache.decl_keys(tree, ucbackend.enable_profiling.kinds)
+            if uccache.enabled() else None)
+    if ucworkers.enabled():
+        codes = run_phase('gen_function_defs', ucworkers.function_code,
+                          tree, global_env, keys)
+    else:
+        codes = run_phase('gen_function_defs', ucbackend.function_code,
+                          tree.decls, global_env, keys)
+    for i, (source, file_codes) in enumerate(
+            zip(sources, ucbackend.split_code(codes, num_files))):
+        with open(source, 'w') as stream:
+            out = ucemit.Emitter(stream)
+            ucbackend.gen_split_source(os.path.basename(header),
+                                       file_codes, i == 0, global_env,
+                                       out)
+            out.flush()
+    with open(rules, 'w') as out:
+        ucbackend.gen_build_rules(rules[:-len('.mk')] + '.exe', header,
+                                  sources, out)
+    print('Wrote code to {0} and {1}.'.format(header, ', '.join(sources)))
+    print('Wrote build rules to {0}.'.format(rules))
+
+
+def enable_time_report():
+    """Record the cost of each phase run by the compiler."""
+    run_phase.records = []
+    tracemalloc.start()
+
+
+def run_phase(name, func, *args):
+    """Run the named compiler phase by calling func with args.
+
+    If the time report is enabled, records the wall time of the
+    phase, the number of AST nodes it created and visited, and the
+    peak memory allocated by Python while it ran and still allocated
+    after it. Returns the result of func.
+    """
+    if run_phase.records is None:
+        return func(*args)
+    visits = ucbase.visit_count()
+    # ids are consumed in order, so this counts the nodes created
+    first_id = ucbase.peek_node_id()
+    tracemalloc.reset_peak()
+    start = time.perf_counter()
+    result = func(*args)
+    seconds = time.perf_counter() - start
+    current, peak = tracemalloc.get_traced_memory()
+    run_phase.records.append({
+        'phase': name,
+        'seconds': seconds,
+        'nodes_created': ucbase.peek_node_id() - first_id,
+        'nodes_visited': ucbase.visit_count() - visits,
+        'peak_kb': peak // 1024,
+        'retained_kb': current // 1024,
+    })
+    return result
+
+
+run_phase.records = None
+
+
+def write_time_report(filename, json_name):
+    """Print the recorded cost of each phase as a table.
+
+    If json_name is given, also writes the report as JSON to the file
+    of that name.
+    """
+    records = run_phase.records
+    print('{0:20}{1:>10}{2:>10}{3:>10}{4:>10}'.format(
+        'phase', 'seconds', 'created', 'visited', 'peak KB'))
+    for record in records:
+        print('{phase:20}{seconds:>10.4f}{nodes_created:>10}'
+              '{nodes_visited:>10}{peak_kb:>10}'.format(**record))
+    total = sum(record['seconds'] for record in records)
+    print('{0:20}{1:>10.4f}'.format('total', total))
+    if json_name:
+        with open(json_name, 'w') as out:
+            json.dump({'file': filename, 'total_s': total,
+                       'peak_kb': max(record['peak_kb']
+                                      for record in records),
+                       'phases': records}, out, indent=2)
+            out.write('\n')
+        print('Wrote time report to {0}.'.format(json_name))
+
+
+def check_split(aparser, args):
+    """Check the --split option in args and split the output.
+
+    Reports an error through aparser if the option is not valid.
+    """
+    if args.split < 1:
+        aparser.error('--split must be at least 1')
+    if args.backend_phase:
+        aparser.error('--split cannot be used with --backend-phase')
+    split_output(args.split)
+
+
 def main():
     """Command-line interface."""
-    aparser = argparse.ArgumentParser(description='Compile a uC '
-                                      'source file.')
+    aparser = ArgumentParser(description='Compile uC source files.',
+                             fromfile_prefix_chars='@')
     group = aparser.add_mutually_exclusive_group(required=True)
-    aparser.add_argument('filename', help='name of uC source file')
+    aparser.add_argument('filenames', nargs='+', metavar='filename',
+                         help='name of uC source file, or @FILE to '
+                         'read more arguments from FILE, one per line')
     group.add_argument('-S', '--analyze-only', action='store_true',
                        help='perform static analysis only')
     group.add_argument('-C', '--code-gen', action='store_true',
@@ -140,6 +428,35 @@ def main():
                          default=0,
                          help='restrict code generation to the given '
                          'backend phase')
+    aparser.add_argument('--profile', metavar='KINDS',
+                         help='instrument the generated code for '
+                         'profiling, where KINDS is a comma-separated '
+                         'list of ' + ', '.join(ucbackend.PROFILE_KINDS)
+                         + ' (e.g. --profile=time)')
+    aparser.add_argument('--split', type=int, metavar='N',
+                         help='write the generated code as a header and '
+                         'N source files, with a makefile fragment that '
+                         'builds them with make -j')
+    aparser.add_argument('--no-pipeline', action='store_true',
+                         help='run each frontend and backend phase as '
+                         'a separate walk of the program, rather than '
+                         'running phases together on each declaration')
+    aparser.add_argument('-j', '--jobs', type=int, default=1,
+                         metavar='N',
+                         help='check declarations and generate function '
+                         'definitions, or compile the given files, in N '
+                         'worker processes')
+    aparser.add_argument('--cache-dir', metavar='DIR',
+                         help='reuse the results of compiling unchanged '
+                         'files, and the code generated for unchanged '
+                         'functions, cached in DIR')
+    aparser.add_argument('--time-report', action='store_true',
+                         help='report the wall time, AST nodes '
+                         'visited, and peak memory of each phase '
+                         '(memory tracing slows every phase down)')
+    aparser.add_argument('--time-report-json', metavar='FILE',
+                         help='also write the time report as JSON to '
+                         'the given file')
     args = aparser.parse_args()
     if args.code_gen and not args.frontend_phase:
         # restrict frontend to first two phases, with no error
@@ -151,9 +468,32 @@ def main():
         args.frontend_phase = 6
     if args.no_errors:
         ucerror.disable_errors()
-    uc_compile(args.filename, args.analyze_only, args.write_types,
-               args.write_graph, args.frontend_phase,
-               args.backend_phase)
+    if args.profile:
+        kinds = args.profile.split(',')
+        for kind in kinds:
+            if kind not in ucbackend.PROFILE_KINDS:
+                aparser.error(f'unknown kind of profiling: {kind}')
+        ucbackend.enable_profiling(kinds)
+    if args.jobs < 1:
+        aparser.error('--jobs must be at least 1')
+    ucworkers.set_jobs(args.jobs)
+    if args.split is not None:
+        check_split(aparser, args)
+    if args.no_pipeline:
+        disable_pipeline()
+    if args.cache_dir:
+        uccache.enable_cache(args.cache_dir)
+    if args.time_report_json and len(args.filenames) > 1:
+        aparser.error('--time-report-json requires a single source file')
+    if args.time_report or args.time_report_json:
+        enable_time_report()
+    if len(args.filenames) > 1 and ucworkers.enabled():
+        results = ucworkers.map_files(args.filenames, compile_file, args)
+    else:
+        results = [compile_file(filename, args)
+                   for filename in args.filenames]
+    if not all(results):
+        sys.exit(1)
 
 
 if __name__ == '__main__':
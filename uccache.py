@@ -0,0 +1,283 @@
+"""
+uccache.py.
+
+This file implements the on-disk cache of the compiler's results.
+Compiling a file is cached under a hash of its source, the compiler's
+own source, and the options it was compiled with, so that an
+unchanged file is not parsed or analyzed again. The generated code of
+each declaration is also cached under a hash of the declaration's
+source and of the declarations of the program's types and function
+signatures, so that editing one function regenerates only that
+function.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import contextlib
+import dataclasses
+import glob
+import hashlib
+import io
+import json
+import os
+import sys
+
+import ucbase
+import ucemit
+
+# bumped whenever the format of the entries changes
+CACHE_FORMAT = 1
+
+# marks the end of a node or list in ast_digest()
+_END = object()
+
+# maps each AST node class to the token that starts it in
+# ast_digest(), and the names of its fields that are given by its
+# source, rather than filled in by analysis, in reverse order
+_SOURCE_FIELDS = {}
+
+
+def enable_cache(directory):
+    """Cache compiled files and generated code in the given directory."""
+    enable_cache.directory = directory
+
+
+enable_cache.directory = None
+
+
+def enabled():
+    """Return whether the cache is enabled."""
+    return enable_cache.directory is not None
+
+
+def compiler_version():
+    """Return a hash of the source of the compiler.
+
+    Any change to the compiler, including the parser, invalidates the
+    cache.
+    """
+    if compiler_version.digest is None:
+        hasher = hashlib.sha256(str(CACHE_FORMAT).encode())
+        here = os.path.dirname(os.path.abspath(__file__))
+        for name in sorted(glob.glob(os.path.join(here, '*.py'))):
+            if os.path.basename(name) != 'parsetab.py':
+                with open(name, 'rb') as source:
+                    hasher.update(source.read())
+        compiler_version.digest = hasher.hexdigest()
+    return compiler_version.digest
+
+
+compiler_version.digest = None
+
+
+def file_key(filename, options):
+    """Return the key of compiling a file with the given options.
+
+    options is a JSON-serializable description of the options that
+    affect the output of the compiler. Returns None if the file cannot
+    be read, in which case compiling it is not cached. The lines of
+    the file are kept for decl_keys(), for when the file is compiled.
+    """
+    file_key.lines = None
+    try:
+        with open(filename, 'rb') as source:
+            contents = source.read()
+    except OSError:
+        return None
+    file_key.lines = contents.splitlines(keepends=True)
+    hasher = hashlib.sha256(compiler_version().encode())
+    hasher.update(json.dumps([filename, options]).encode())
+    hasher.update(contents)
+    return hasher.hexdigest()
+
+
+file_key.lines = None
+
+
+def _entry_path(kind, key):
+    """Return the path of the cache entry of the given kind and key."""
+    return os.path.join(enable_cache.directory, kind, key[:2], key)
+
+
+def _read_entry(kind, key):
+    """Return the contents of a cache entry, or None if it is absent."""
+    try:
+        with open(_entry_path(kind, key)) as entry:
+            return entry.read()
+    except OSError:
+        return None
+
+
+def _write_entry(kind, key, contents):
+    """Write a cache entry.
+
+    The entry is written to a temporary file that is then renamed, so
+    that a concurrent compile never reads a partial entry.
+    """
+    path = _entry_path(kind, key)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    temp = f'{path}.{os.getpid()}.tmp'
+    with open(temp, 'w') as entry:
+        entry.write(contents)
+    os.replace(temp, path)
+
+
+def restore_file(key):
+    """Restore the results of compiling a file, if they are cached.
+
+    Prints the output that the compiler printed, and rewrites the
+    files that it wrote. Returns whether the results were cached.
+    """
+    contents = _read_entry('files', key)
+    if contents is None:
+        return False
+    entry = json.loads(contents)
+    for name, text in entry['files'].items():
+        with open(name, 'w') as out:
+            out.write(text)
+    print(entry['output'], end='')
+    return True
+
+
+def store_file(key, output, filenames):
+    """Cache the results of compiling a file.
+
+    output is what the compiler printed, and filenames are the files
+    that it wrote.
+    """
+    files = {}
+    for name in filenames:
+        with open(name) as written:
+            files[name] = written.read()
+    _write_entry('files', key, json.dumps({'output': output,
+                                           'files': files}))
+
+
+class _Tee(io.TextIOBase):
+    """A stream that writes to another stream and records the text."""
+
+    def __init__(self, stream):
+        """Initialize this stream to write to the given stream."""
+        super().__init__()
+        self.stream = stream
+        self.text = io.StringIO()
+
+    def write(self, text):
+        """Write text to the underlying stream and record it."""
+        self.text.write(text)
+        return self.stream.write(text)
+
+    def flush(self):
+        """Flush the underlying stream."""
+        self.stream.flush()
+
+
+@contextlib.contextmanager
+def recording_output():
+    """Record what is printed to standard out in the managed block.
+
+    Yields a StringIO that holds the text printed so far. The text is
+    still printed as usual.
+    """
+    tee = _Tee(sys.stdout)
+    with contextlib.redirect_stdout(tee):
+        yield tee.text
+
+
+def ast_digest(item, hasher):
+    """Update hasher with the source-level structure of an AST item.
+
+    The fields that analysis fills in are left out, as are node ids
+    and source positions.
+    """
+    parts = []
+    stack = [item]
+    while stack:
+        item = stack.pop()
+        if isinstance(item, ucbase.ASTNode):
+            cls = type(item)
+            fields = _SOURCE_FIELDS.get(cls)
+            if fields is None:
+                fields = _SOURCE_FIELDS[cls] = ('(' + cls.__name__, tuple(
+                    field.name for field in dataclasses.fields(cls)
+                    if field.init and field.name != 'position'
+                )[::-1])
+            parts.append(fields[0])
+            stack.append(_END)
+            stack.extend([getattr(item, name) for name in fields[1]])
+        elif isinstance(item, list):
+            parts.append('[')
+            stack.append(_END)
+            stack.extend(item[::-1])
+        elif item is _END:
+            parts.append(')')
+        else:
+            parts.append(repr(item))
+    hasher.update('\0'.join(parts).encode())
+
+
+def interface_digest(tree):
+    """Return a hash of the types and function signatures of a program.
+
+    This is what the generated code of one declaration may depend on
+    from the rest of the program: the fields of types and the
+    parameter and return types of functions.
+    """
+    hasher = hashlib.sha256(compiler_version().encode())
+    for decl in tree.decls:
+        if isinstance(decl, ucbase.FunctionDeclNode):
+            ast_digest([decl.rettype, decl.name, decl.parameters], hasher)
+        else:
+            ast_digest(decl, hasher)
+    return hasher.hexdigest()
+
+
+def decl_keys(tree, profile):
+    """Return the cache keys of the generated code of each declaration.
+
+    The result maps the node id of each declaration to its key, or is
+    None if the source of the program is not known. A declaration's
+    key is a hash of the program's interface, the given kinds of
+    profiling, and the source lines from the start of the declaration
+    to the start of the next. A declaration's position may come after
+    its return type and name, but those are part of the interface.
+    Walking the declaration's AST instead would cost about as much as
+    generating its code. Profiled code refers to source lines, so the
+    line number of a declaration is part of its key if profile is
+    nonempty.
+    """
+    lines = file_key.lines
+    if lines is None:
+        return None
+    interface = interface_digest(tree)
+    starts = [decl.position - 1 for decl in tree.decls] + [len(lines)]
+    keys = {}
+    for i, decl in enumerate(tree.decls):
+        hasher = hashlib.sha256(interface.encode())
+        hasher.update(','.join(sorted(profile)).encode())
+        if profile:
+            hasher.update(b'@%d' % decl.position)
+        # the next declaration may start on the same line that this
+        # one ends on
+        hasher.update(b''.join(lines[starts[i]:starts[i + 1] + 1]))
+        keys[decl.node_id] = hasher.hexdigest()
+    return keys
+
+
+def gen_function_defs(decls, ctx, keys):
+    """Generate the function definitions of decls, reusing cached code.
+
+    keys holds the cache key of each declaration, as returned by
+    decl_keys().
+    """
+    out = ctx.out
+    for decl in decls:
+        key = keys[decl.node_id]
+        code = _read_entry('functions', key)
+        if code is None:
+            ctx.out = ucemit.Emitter()
+            decl.gen_function_defs(ctx)
+            code = ctx.out.getvalue()
+            _write_entry('functions', key, code)
+        out.write(code)
+    ctx.out = out
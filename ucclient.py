@@ -0,0 +1,142 @@
+"""
+ucclient.py.
+
+This file implements the client of the uC compile server. It takes
+the same arguments as ucc.py and has the compile server run ucc.py
+with them in the client's working directory, printing the server's
+output and exiting with its exit status. If no server is running, it
+runs ucc.py itself, so the result is the same either way.
+
+The client imports as little as it can, so that it starts up
+quickly. The protocol is defined here and also used by ucserver.py.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import os
+import socket
+import struct
+import sys
+
+# the kind of the frame sent by the client, which holds the working
+# directory and the arguments, separated by null bytes
+REQUEST = b'r'
+
+# the kinds of frames sent by the server: output to standard out,
+# output to standard error, and the exit status, which is sent last
+STDOUT = b'o'
+STDERR = b'e'
+EXIT = b'x'
+
+# the header of a frame: its kind and the length of its data
+HEADER = struct.Struct('!cI')
+
+
+def socket_dir():
+    """Return the directory that holds the server's socket by default.
+
+    This is $XDG_RUNTIME_DIR, which is private to the user, or else a
+    directory in $TMPDIR, or /tmp, that the server creates private to
+    the user.
+    """
+    return (os.environ.get('XDG_RUNTIME_DIR')
+            or os.path.join(os.environ.get('TMPDIR') or '/tmp',
+                            'ucc-{0}'.format(os.getuid())))
+
+
+def default_socket():
+    """Return the path of the server's socket.
+
+    The path is given by the UCC_SOCKET environment variable, or else
+    is a file in socket_dir().
+    """
+    return (os.environ.get('UCC_SOCKET')
+            or os.path.join(socket_dir(), 'ucc.sock'))
+
+
+def same_user(conn):
+    """Return whether the peer of a connected Unix socket is this user.
+
+    Where the system cannot tell, the permissions of the socket are
+    relied on instead.
+    """
+    if not hasattr(socket, 'SO_PEERCRED'):
+        return True
+    creds = struct.Struct('3i')
+    _, uid, _ = creds.unpack(conn.getsockopt(
+        socket.SOL_SOCKET, socket.SO_PEERCRED, creds.size))
+    return uid == os.getuid()
+
+
+def send_frame(conn, kind, data):
+    """Send a frame of the given kind with the given bytes."""
+    conn.sendall(HEADER.pack(kind, len(data)) + data)
+
+
+def _receive(conn, size):
+    """Receive exactly size bytes, or None if the connection closed."""
+    data = b''
+    while len(data) < size:
+        chunk = conn.recv(size - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return data
+
+
+def receive_frame(conn):
+    """Receive a frame, returning its kind and data.
+
+    Returns None if the connection closed before a whole frame was
+    received.
+    """
+    header = _receive(conn, HEADER.size)
+    if header is None:
+        return None
+    kind, size = HEADER.unpack(header)
+    data = _receive(conn, size)
+    return None if data is None else (kind, data)
+
+
+def run_local(args):
+    """Replace this process with ucc.py run on the given arguments."""
+    ucc = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                       'ucc.py')
+    os.execv(sys.executable, [sys.executable, ucc] + args)
+
+
+def main():
+    """Command-line interface."""
+    args = sys.argv[1:]
+    conn = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    try:
+        conn.connect(default_socket())
+    except OSError:
+        conn.close()
+        run_local(args)
+    if not same_user(conn):
+        print('ucclient.py: ignoring a compile server run by another '
+              'user', file=sys.stderr)
+        conn.close()
+        run_local(args)
+    with conn:
+        send_frame(conn, REQUEST, b'\0'.join(
+            os.fsencode(arg) for arg in [os.getcwd()] + args))
+        while True:
+            frame = receive_frame(conn)
+            if frame is None:
+                print('ucclient.py: lost connection to the compile server',
+                      file=sys.stderr)
+                sys.exit(1)
+            kind, data = frame
+            if kind == EXIT:
+                sys.stdout.flush()
+                sys.exit(int(data))
+            stream = sys.stdout if kind == STDOUT else sys.stderr
+            stream.flush()
+            stream.buffer.write(data)
+            stream.buffer.flush()
+
+
+if __name__ == '__main__':
+    main()
@@ -7,8 +7,12 @@ frontend and backend.
 Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
 """
 
-import sys
+import contextlib
 import copy
+import sys
+
+# the text added to the indentation of each nested level of code
+INDENT = '  '
 
 
 class PhaseContext:
@@ -65,15 +69,41 @@ class PhaseContext:
         """Return whether the given key exists in this context."""
         return key in self._info
 
-    def print(self, *args, **kwargs):
+    def print(self, *args, sep=' ', end='\n', indent=False):
         """Print to the context's output.
 
         Indents with this context's indent string if indent=True is
         provided. The trailing newline can be suppressed by end='',
-        as with the standard print() function.
+        as with the standard print() function. The text is written
+        to the output in a single call.
+        """
+        if len(args) == 1 and isinstance(args[0], str):
+            text = args[0] + end
+        else:
+            text = sep.join(map(str, args)) + end
+        self.out.write(self.indent + text if indent else text)
+
+    def indented(self, levels=1):
+        """Return a clone of this context that is indented further.
+
+        The clone's indent string has the given number of levels
+        added to this context's.
+        """
+        new_ctx = self.clone()
+        new_ctx.indent += INDENT * levels
+        return new_ctx
+
+    @contextlib.contextmanager
+    def nested(self):
+        """Indent this context one level further in the managed block.
+
+        The indent string is restored when the block exits, so that
+        the code that follows lines up with the code that opened the
+        block.
         """
-        if 'indent' in kwargs:
-            if kwargs['indent']:
-                print(self.indent, file=self.out, end='')
-            del kwargs['indent']
-        print(*args, file=self.out, **kwargs)
+        indent = self.indent
+        self.indent += INDENT
+        try:
+            yield self
+        finally:
+            self.indent = indent
@@ -0,0 +1,57 @@
+"""
+ucemit.py.
+
+This file defines the Emitter type, which buffers the code generated
+by the backend. Generated code is emitted in many small fragments, a
+few per AST node, and writing each to a file separately is costly. An
+Emitter instead appends the fragments to a list of chunks, which is
+joined and written to the underlying file in large blocks. An Emitter
+without a file holds its text in memory, so that separate sections of
+the output can be generated at once and then written out in order.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+# number of chunks held before they are written out as one block
+FLUSH_CHUNKS = 8192
+
+
+class Emitter:
+    """A buffer of generated code.
+
+    stream is the file that the code is written to, or None if the
+    code is only held in memory, to be retrieved by getvalue() or
+    moved into another emitter by extend().
+    """
+
+    def __init__(self, stream=None):
+        """Initialize this emitter to write to the given stream."""
+        self.stream = stream
+        self.chunks = []
+
+    def write(self, text):
+        """Append text to this emitter.
+
+        Once enough chunks are held, they are written to the stream.
+        """
+        chunks = self.chunks
+        chunks.append(text)
+        if len(chunks) >= FLUSH_CHUNKS and self.stream is not None:
+            self.flush()
+
+    def extend(self, other):
+        """Move the text held by another emitter into this one."""
+        self.chunks.extend(other.chunks)
+        other.chunks = []
+        if len(self.chunks) >= FLUSH_CHUNKS and self.stream is not None:
+            self.flush()
+
+    def flush(self):
+        """Write the held text to the stream, if there is one."""
+        if self.stream is not None and self.chunks:
+            self.stream.write(''.join(self.chunks))
+            self.chunks = []
+
+    def getvalue(self):
+        """Return the text held by this emitter."""
+        return ''.join(self.chunks)
@@ -16,13 +16,21 @@ def error(phase, position, message):
     checking is disabled, does nothing.
     """
     if not error.disabled:
-        print('Error ({}) at line {}: {}'.format(phase, position,
-                                                 message))
+        text = 'Error ({}) at line {}: {}'.format(phase, position, message)
+        if error.buffers is None:
+            print(text)
+        else:
+            error.buffers.setdefault(error.phase, []).append(text)
         error.num_errors += 1
 
 
 error.disabled = False
 error.num_errors = 0
+# when buffering, maps each phase to the messages reported while it
+# was running
+error.buffers = None
+# the phase that is running, when buffering
+error.phase = 0
 
 
 def error_count():
@@ -30,6 +38,67 @@ def error_count():
     return error.num_errors
 
 
+def reset_errors():
+    """Forget the errors reported so far, before checking a new file."""
+    error.num_errors = 0
+    error.buffers = None
+    error.phase = 0
+
+
 def disable_errors():
     """Disable error checking."""
     error.disabled = True
+
+
+def buffer_errors():
+    """Hold error messages until flush_errors() is called.
+
+    Messages are held separately for each phase, as set by
+    set_phase(), so that phases that are run together can report
+    their errors as if they had been run one after another.
+    """
+    error.buffers = {}
+
+
+def set_phase(phase):
+    """Set the phase that is running, returning the previous one."""
+    previous = error.phase
+    error.phase = phase
+    return previous
+
+
+def first_error_phase():
+    """Return the earliest phase with held errors, or None if none."""
+    return min(error.buffers, default=None)
+
+
+def hold_errors(buffers):
+    """Hold the given errors as if they had just been reported.
+
+    buffers maps each phase to a list of messages, as held by
+    buffer_errors().
+    """
+    for phase, messages in buffers.items():
+        error.buffers.setdefault(phase, []).extend(messages)
+        error.num_errors += len(messages)
+
+
+def held_errors():
+    """Return the errors held so far, by phase."""
+    return error.buffers
+
+
+def flush_errors(phase):
+    """Print the errors held for the given phase.
+
+    Returns the number of errors that were printed.
+    """
+    messages = error.buffers.pop(phase, [])
+    for text in messages:
+        print(text)
+    return len(messages)
+
+
+def unbuffer_errors():
+    """Discard any held errors, and print future errors immediately."""
+    error.buffers = None
@@ -174,11 +174,24 @@ class NameExpressionNode(ExpressionNode):
         """Generate function defs."""
         ctx.print(f"UC_VAR({self.name.raw})", end="")
 
+
 #######################
 # Calls and Accessors #
 #######################
 
 
+def alloc_site(node, ctx):
+    """Return the allocation site argument for a new expression.
+
+    The site is identified by the name of the type that is allocated
+    and the source line. Returns None unless allocations are being
+    profiled.
+    """
+    if 'alloc' not in ctx['profile']:
+        return None
+    return f'UC_ALLOC_SITE("{node.type.name}", {node.position})'
+
+
 @dataclass
 class CallNode(ExpressionNode):
     """An AST node representing a function-call expression.
@@ -212,7 +225,7 @@ class CallNode(ExpressionNode):
         """
         super().type_check(ctx)
         self.func.check_args(6, self.position, self.args)
-        self.type = self.func.rettype
+        self.type = self.func.return_type(self.args)
 
     def gen_function_defs(self, ctx):
         """Generate function defs."""
@@ -262,8 +275,17 @@ class NewNode(ExpressionNode):
 
     def gen_function_defs(self, ctx):
         """Generate function defs."""
-        ctx.print(f"uc_make_object<{self.type.mangle()}>", end="")
+        site = alloc_site(self, ctx)
+        if isinstance(self.type, uctypes.ValueType):
+            ctx.print(self.type.mangle(), end="")
+            site = None
+        elif site:
+            ctx.print(f"uc_make_object_at<{self.type.mangle()}>", end="")
+        else:
+            ctx.print(f"uc_make_object<{self.type.mangle()}>", end="")
         ctx.print("(", end="")
+        if site:
+            ctx.print(site + (", " if self.args else ""), end="")
         for i, arg in enumerate(self.args):
             arg.gen_function_defs(ctx)
             if i != len(self.args)-1:
@@ -305,9 +327,13 @@ class NewArrayNode(ExpressionNode):
 
     def gen_function_defs(self, ctx):
         """Generate function defs."""
+        site = alloc_site(self, ctx)
         ctx.print(
-            f"uc_make_array_of<{self.elem_type.type.mangle()}>", end="")
+            f"uc_make_array_of{'_at' if site else ''}"
+            + f"<{self.elem_type.type.mangle()}>", end="")
         ctx.print("(", end="")
+        if site:
+            ctx.print(site + (", " if self.args else ""), end="")
         for i, arg in enumerate(self.args):
             arg.gen_function_defs(ctx)
             if i != len(self.args)-1:
@@ -315,6 +341,130 @@ class NewArrayNode(ExpressionNode):
         ctx.print(")", end="")
 
 
+@dataclass
+class NewSizedArrayNode(ExpressionNode):
+    """An AST node representing a new expression for a sized array.
+
+    elem_type is a node representing the element type and size is an
+    expression for the number of elements, each of which starts with
+    its default value.
+    """
+
+    elem_type: ucbase.BaseTypeNameNode
+    size: ExpressionNode
+
+    def resolve_types(self, ctx):
+        """Resolve type names to the actual types they name.
+
+        Uses ctx.global_env to look up a type name. Reports
+        an error if an unknown type is named.
+        """
+        super().resolve_types(ctx)
+        self.type = self.elem_type.type.array_type
+
+    def type_check(self, ctx):
+        """Compute the type of each expression.
+
+        Uses ctx['local_env'] to compute the type of a local name.
+        Checks that the type of an expression is compatible with the
+        context in which it is used.
+        """
+        super().type_check(ctx)
+        if self.size.type.name != 'int':
+            error(6, self.position,
+                  "array size expects type int, "
+                  + f"but got type {self.size.type}")
+
+    def gen_function_defs(self, ctx):
+        """Generate function defs."""
+        site = alloc_site(self, ctx)
+        ctx.print(
+            f"uc_make_array_of_size{'_at' if site else ''}"
+            + f"<{self.elem_type.type.mangle()}>(", end="")
+        if site:
+            ctx.print(site + ", ", end="")
+        self.size.gen_function_defs(ctx)
+        ctx.print(")", end="")
+
+
+@dataclass
+class NewMatrixNode(ExpressionNode):
+    """An AST node representing a new expression for a matrix.
+
+    elem_type is a node representing the element type, and rows and
+    cols are expressions for the dimensions of the matrix, each of
+    whose elements starts with its default value.
+    """
+
+    elem_type: ucbase.BaseTypeNameNode
+    rows: ExpressionNode
+    cols: ExpressionNode
+
+    def resolve_types(self, ctx):
+        """Resolve type names to the actual types they name.
+
+        Uses ctx.global_env to look up a type name. Reports
+        an error if an unknown type is named.
+        """
+        super().resolve_types(ctx)
+        self.type = self.elem_type.type.matrix_type
+
+    def type_check(self, ctx):
+        """Compute the type of each expression.
+
+        Uses ctx['local_env'] to compute the type of a local name.
+        Checks that the type of an expression is compatible with the
+        context in which it is used.
+        """
+        super().type_check(ctx)
+        for dim in (self.rows, self.cols):
+            if dim.type.name != 'int':
+                error(6, self.position,
+                      "matrix size expects type int, "
+                      + f"but got type {dim.type}")
+
+    def gen_function_defs(self, ctx):
+        """Generate function defs."""
+        site = alloc_site(self, ctx)
+        ctx.print(
+            f"uc_make_matrix_of_size{'_at' if site else ''}"
+            + f"<{self.elem_type.type.mangle()}>(", end="")
+        if site:
+            ctx.print(site + ", ", end="")
+        self.rows.gen_function_defs(ctx)
+        ctx.print(", ", end="")
+        self.cols.gen_function_defs(ctx)
+        ctx.print(")", end="")
+
+
+@dataclass
+class NewMapNode(ExpressionNode):
+    """An AST node representing a new expression for an empty map.
+
+    map_type is a node representing the type of the map.
+    """
+
+    map_type: ucbase.MapTypeNameNode
+
+    def resolve_types(self, ctx):
+        """Resolve type names to the actual types they name.
+
+        Uses ctx.global_env to look up a type name. Reports
+        an error if an unknown type is named.
+        """
+        super().resolve_types(ctx)
+        self.type = self.map_type.type
+
+    def gen_function_defs(self, ctx):
+        """Generate function defs."""
+        site = alloc_site(self, ctx)
+        if site:
+            ctx.print(f"uc_make_object_at<{self.type.mangle()}>({site})",
+                      end="")
+        else:
+            ctx.print(f"uc_make_object<{self.type.mangle()}>()", end="")
+
+
 @dataclass
 class FieldAccessNode(ExpressionNode):
     """An AST node representing access to a field of an object.
@@ -330,8 +480,12 @@ class FieldAccessNode(ExpressionNode):
     # add your code below
     def is_lvalue(self):
         """Return whether or not this node produces an l-value."""
-        if isinstance(self.receiver.type, uctypes.ArrayType):
+        if isinstance(self.receiver.type,
+                      (uctypes.ArrayType, uctypes.MatrixType,
+                       uctypes.MapType)):
             return False
+        if isinstance(self.receiver.type, uctypes.ValueType):
+            return self.receiver.is_lvalue()
         return True
 
     def type_check(self, ctx):
@@ -354,8 +508,8 @@ class FieldAccessNode(ExpressionNode):
 
     def gen_function_defs(self, ctx):
         """Generate function defs."""
-        if self.field.raw == "length":
-            ctx.print("uc_length_field(", end="")
+        if self.field.raw in ("length", "rows", "cols"):
+            ctx.print(f"uc_{self.field.raw}_field(", end="")
             self.receiver.gen_function_defs(ctx)
             ctx.print(")", end="")
         else:
@@ -408,6 +562,57 @@ class ArrayIndexNode(ExpressionNode):
         self.index.gen_function_defs(ctx)
         ctx.print(")", end="")
 
+
+@dataclass
+class MatrixIndexNode(ExpressionNode):
+    """An AST node representing indexing into a matrix.
+
+    receiver is an expression representing the matrix, and row and
+    col are the index expressions.
+    """
+
+    receiver: ExpressionNode
+    row: ExpressionNode
+    col: ExpressionNode
+
+    @staticmethod
+    def is_lvalue():
+        """Return whether or not this node produces an l-value."""
+        return True
+
+    def type_check(self, ctx):
+        """Compute the type of each expression.
+
+        Uses ctx['local_env'] to compute the type of a local name.
+        Checks that the type of an expression is compatible with the
+        context in which it is used.
+        """
+        super().type_check(ctx)
+        if not isinstance(self.receiver.type, uctypes.MatrixType):
+            error(6, self.position,
+                  f"cannot index into non-matrix type {self.receiver.type}")
+            self.type = ctx.global_env.lookup_type(6, self.position, 'int')
+        elif self.row.type.name != 'int' or self.col.type.name != 'int':
+            index_type = (self.row.type if self.row.type.name != 'int'
+                          else self.col.type)
+            error(6, self.position,
+                  "matrix index expects type int, "
+                  + f"but got type {index_type}")
+            self.type = ctx.global_env.lookup_type(6, self.position, 'int')
+        else:
+            self.type = self.receiver.type.elem_type
+
+    def gen_function_defs(self, ctx):
+        """Generate function defs."""
+        ctx.print("uc_matrix_index(", end="")
+        self.receiver.gen_function_defs(ctx)
+        ctx.print(", ", end="")
+        self.row.gen_function_defs(ctx)
+        ctx.print(", ", end="")
+        self.col.gen_function_defs(ctx)
+        ctx.print(")", end="")
+
+
 #####################
 # Unary Expressions #
 #####################
@@ -549,8 +754,8 @@ class IDNode(UnaryPrefixNode):
         context in which it is used.
         """
         super().type_check(ctx)
-        if isinstance(self.expr.type, uctypes.PrimitiveType)\
-                and not isinstance(self.expr.type, uctypes.ArrayType):
+        if isinstance(self.expr.type,
+                      (uctypes.PrimitiveType, uctypes.ValueType)):
             error(6, self.position,
                   "subexpression was of type "
                   + f"{self.expr.type}, but must be of reference type")
@@ -0,0 +1,583 @@
+"""
+ucfastparse.py.
+
+This file implements a fast path for parsing uC source code: a lexer
+built on a single regular expression and a recursive-descent parser.
+It constructs the same AST as the PLY parser in ucparser.py, with the
+same nodes in the same order, so that node ids and source positions
+are identical.
+
+The fast path handles only programs without errors. On any lexical or
+syntax error, or on anything it does not recognize, it gives up and
+the PLY parser is run instead, which reports the errors. It must
+therefore never accept a program that the PLY parser rejects, or
+parse one differently, but it may reject programs that the PLY parser
+accepts.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import gc
+import itertools
+import re
+
+import ucbase
+import ucexpr
+import ucstmt
+
+# the tokens of uC, in the order that the PLY lexer's master regular
+# expression tries them: rules defined by functions first, then rules
+# defined by strings, longest regular expression first. A character
+# that starts no token is a token of its own, which the parser
+# rejects.
+_TOKENS = r'''
+    [a-zA-Z][a-zA-Z_0-9]*
+  | \"(?:[^\\\n]|\\.)*?\"
+  | (?:(?:\d*\.\d+)|(?:\d+\.))(?:e(?:\+|-)?\d+)? | \d+e(?:\+|-)?\d+
+  | \d+[lL]?
+  | \|\| | \+\+ | \+ | \* | && | <= | >= | == | != | << | >> | --
+  | \# | \( | \) | \[ | \] | \{ | \} | \. | - | / | % | ! | < | >
+  | = | , | ;
+  | \S
+'''
+
+# a string or comment, found in the same way as the PLY lexer finds
+# them, so that a comment within a string is left alone
+_STRING_OR_COMMENT = re.compile(
+    r'\"(?:[^\\\n]|\\.)*?\" | //.*\n | /\*[\s\S]*?\*/', re.VERBOSE
+)
+
+# whitespace followed by a token or a comment, within a single line of
+# code. Splitting each line into tokens separately is much faster than
+# splitting the whole code at once and counting newlines.
+_LINE_TOKEN = re.compile(r'\s* (//.* | ' + _TOKENS + ')', re.VERBOSE)
+
+# reserved words, which are not names
+RESERVED = frozenset(('if', 'else', 'while', 'for', 'struct', 'break',
+                      'continue', 'return', 'true', 'false', 'new',
+                      'null'))
+
+# characters that start a name
+NAME_START = frozenset('abcdefghijklmnopqrstuvwxyz'
+                       'ABCDEFGHIJKLMNOPQRSTUVWXYZ')
+
+# characters that start a number
+DIGITS = frozenset('0123456789')
+NUMBER_START = DIGITS | {'.'}
+
+UNARY_OPS = {
+    '+': ucexpr.PrefixPlusNode,
+    '-': ucexpr.PrefixMinusNode,
+    '!': ucexpr.NotNode,
+    '++': ucexpr.PrefixIncrNode,
+    '--': ucexpr.PrefixDecrNode,
+    '#': ucexpr.IDNode
+}
+
+# maps each binary operator to its node class, its precedence level,
+# and whether it is right associative. Levels are those of the PLY
+# parser's precedence table, with prefix operators at level 9 and
+# field access and indexing at level 10.
+BINARY_OPS = {
+    '<<': (ucexpr.PushNode, 1, False),
+    '>>': (ucexpr.PopNode, 1, False),
+    '=': (ucexpr.AssignNode, 2, True),
+    '||': (ucexpr.LogicalOrNode, 3, False),
+    '&&': (ucexpr.LogicalAndNode, 4, False),
+    '==': (ucexpr.EqualNode, 5, False),
+    '!=': (ucexpr.NotEqualNode, 5, False),
+    '<': (ucexpr.LessNode, 6, False),
+    '<=': (ucexpr.LessEqualNode, 6, False),
+    '>': (ucexpr.GreaterNode, 6, False),
+    '>=': (ucexpr.GreaterEqualNode, 6, False),
+    '+': (ucexpr.PlusNode, 7, False),
+    '-': (ucexpr.MinusNode, 7, False),
+    '*': (ucexpr.TimesNode, 8, False),
+    '/': (ucexpr.DivideNode, 8, False),
+    '%': (ucexpr.ModuloNode, 8, False),
+}
+
+# levels whose operators are not associative, so that a second
+# operator of the same level is a syntax error
+NONASSOC_LEVELS = frozenset((5, 6))
+
+
+class GiveUp(Exception):
+    """Raised when the fast path cannot parse a program."""
+
+
+def _blank_comment(match):
+    """Replace a block comment with whitespace of the same lines.
+
+    Strings and line comments are left as they are.
+    """
+    text = match.group()
+    if text[:2] != '/*':
+        return text
+    return ' ' + '\n' * text.count('\n')
+
+
+def tokenize(text):
+    """Split uC source code into tokens.
+
+    Returns a list of the text of each token, ending with an empty
+    token, and a list of the line number of each token.
+    """
+    if '/*' in text:
+        text = _STRING_OR_COMMENT.sub(_blank_comment, text)
+    tokens = []
+    lines = []
+    findall = _LINE_TOKEN.findall
+    segments = text.split('\n')
+    for number, line in enumerate(segments, 1):
+        line_tokens = findall(line)
+        # a comment must end with a newline, so one on the last line
+        # is left for the parser to reject
+        if ('//' in line and line_tokens[-1][:2] == '//'
+                and number < len(segments)):
+            line_tokens.pop()
+        tokens += line_tokens
+        lines += [number] * len(line_tokens)
+    tokens.append('')
+    lines.append(len(segments))
+    return tokens, lines
+
+
+def parse(text):
+    """Parse uC source code, returning its AST.
+
+    Returns None if the code has errors or cannot be parsed by the
+    fast path, in which case no node ids are used up. The garbage
+    collector is paused while parsing, since every node allocated is
+    part of the AST and scanning them for cycles is wasted work that
+    would otherwise take about as long as the parse itself.
+    """
+    first_id = ucbase.peek_node_id()
+    collecting = gc.isenabled()
+    gc.disable()
+    try:
+        return _Parser(*tokenize(text)).program()
+    except (GiveUp, RecursionError):
+        ucbase.ASTNode.next_id = itertools.count(first_id)
+        return None
+    finally:
+        if collecting:
+            gc.enable()
+
+
+class _Parser:  # pylint: disable=too-many-public-methods
+    """A recursive-descent parser over a list of tokens.
+
+    Each method parses a construct starting at the current token and
+    leaves the current token just after it. Nodes are constructed in
+    the order that the PLY parser reduces them.
+    """
+
+    def __init__(self, tokens, lines):
+        """Initialize this parser to parse the given tokens."""
+        self.tokens = tokens
+        self.lines = lines
+        self.pos = 0
+        # whether a parallel for has been parsed
+        self.parallel = False
+
+    def expect(self, token):
+        """Skip the given token, giving up if it is not next."""
+        if self.tokens[self.pos] != token:
+            raise GiveUp
+        self.pos += 1
+
+    def name(self):
+        """Parse a name."""
+        pos = self.pos
+        token = self.tokens[pos]
+        if token[:1] not in NAME_START or token in RESERVED:
+            raise GiveUp
+        self.pos = pos + 1
+        return ucbase.NameNode(self.lines[pos], token)
+
+    def program(self):
+        """Parse a whole program."""
+        # the PLY parser reads the first token before it reduces the
+        # empty list of declarations, whose position is its line
+        position = self.lines[0]
+        decls = []
+        tokens = self.tokens
+        while tokens[self.pos]:
+            decls.append(self.declaration())
+        tree = ucbase.ProgramNode(position, decls)
+        tree.parallel = self.parallel
+        return tree
+
+    def declaration(self):
+        """Parse a type or function declaration."""
+        tokens = self.tokens
+        if tokens[self.pos] == 'struct':
+            position = self.lines[self.pos]
+            self.pos += 1
+            return self.struct_decl(position, False)
+        if tokens[self.pos + 1] == 'struct':
+            if self.name().raw != 'value':
+                raise GiveUp
+            position = self.lines[self.pos]
+            self.pos += 1
+            return self.struct_decl(position, True)
+        rettype = self.type()
+        name = self.name()
+        position = self.lines[self.pos]
+        self.expect('(')
+        parameters = self.var_decls(ucbase.ParameterNode)
+        self.expect(')')
+        self.expect('(')
+        vardecls = self.var_decls(ucbase.VarDeclNode)
+        self.expect(')')
+        return ucbase.FunctionDeclNode(position, rettype, name, parameters,
+                                       vardecls, self.block())
+
+    def struct_decl(self, position, is_value):
+        """Parse the rest of a struct declaration, after struct."""
+        name = self.name()
+        self.expect('(')
+        vardecls = self.var_decls(ucbase.VarDeclNode)
+        self.expect(')')
+        self.expect(';')
+        if is_value:
+            return ucbase.StructDeclNode(position, name, vardecls, True)
+        return ucbase.StructDeclNode(position, name, vardecls)
+
+    def var_decls(self, node_class):
+        """Parse a possibly empty list of declarations, up to a ')'.
+
+        Each declaration is a type and a name, from which a node of
+        the given class is constructed.
+        """
+        decls = []
+        if self.tokens[self.pos] != ')':
+            while True:
+                position = self.lines[self.pos]
+                vartype = self.type()
+                decls.append(node_class(position, vartype, self.name()))
+                if self.tokens[self.pos] != ',':
+                    break
+                self.pos += 1
+        return decls
+
+    def type(self):
+        """Parse a type."""
+        position = self.lines[self.pos]
+        name = self.name()
+        if self.tokens[self.pos] == '<':
+            result = self.map_type(name)
+        else:
+            result = ucbase.TypeNameNode(position, name)
+        return self.type_suffixes(result, position)
+
+    def type_suffixes(self, result, position):
+        """Parse the array and matrix suffixes of a type.
+
+        result is the type without suffixes, which starts at the
+        given position. Stops at a '[' that starts the size of a new
+        array.
+        """
+        tokens = self.tokens
+        while tokens[self.pos] == '[':
+            if tokens[self.pos + 1] == ']':
+                self.pos += 2
+                result = ucbase.ArrayTypeNameNode(position, result)
+            elif tokens[self.pos + 1] == ',' and tokens[self.pos + 2] == ']':
+                self.pos += 3
+                result = ucbase.MatrixTypeNameNode(position, result)
+            else:
+                # the size of a new array
+                break
+        return result
+
+    def map_type(self, name):
+        """Parse the rest of a map type, after its name."""
+        if name.raw != 'map':
+            raise GiveUp
+        self.pos += 1
+        key_type = self.type()
+        self.expect(',')
+        value_type = self.type()
+        self.expect('>')
+        return ucbase.MapTypeNameNode(name.position, key_type, value_type)
+
+    def block(self):
+        """Parse a block."""
+        position = self.lines[self.pos]
+        self.expect('{')
+        statements = []
+        tokens = self.tokens
+        while tokens[self.pos] != '}':
+            if not tokens[self.pos]:
+                raise GiveUp
+            statements.append(self.statement())
+        self.pos += 1
+        return ucstmt.BlockNode(position, statements)
+
+    def statement(self):
+        """Parse a statement."""
+        pos = self.pos
+        token = self.tokens[pos]
+        if token == 'if':
+            return self.if_statement()
+        if token == 'while':
+            return self.while_statement()
+        if token == 'for':
+            self.pos += 1
+            return self.for_statement(ucstmt.ForNode, self.lines[pos])
+        if token in ('break', 'continue', 'return'):
+            return self.jump_statement()
+        if self.tokens[pos + 1] == 'for':
+            if self.name().raw != 'parallel':
+                raise GiveUp
+            self.pos += 1
+            self.parallel = True
+            return self.for_statement(ucstmt.ParallelForNode,
+                                      self.lines[pos + 1])
+        expr = self.expression()
+        position = self.lines[self.pos]
+        self.expect(';')
+        return ucstmt.ExpressionStatementNode(position, expr)
+
+    def while_statement(self):
+        """Parse a while statement."""
+        position = self.lines[self.pos]
+        self.pos += 1
+        self.expect('(')
+        test = self.expression()
+        self.expect(')')
+        return ucstmt.WhileNode(position, test, self.block())
+
+    def jump_statement(self):
+        """Parse a break, continue, or return statement."""
+        token = self.tokens[self.pos]
+        position = self.lines[self.pos]
+        self.pos += 1
+        if token == 'break':
+            result = ucstmt.BreakNode(position)
+        elif token == 'continue':
+            result = ucstmt.ContinueNode(position)
+        elif self.tokens[self.pos] == ';':
+            result = ucstmt.ReturnNode(position, None)
+        else:
+            result = ucstmt.ReturnNode(position, self.expression())
+        self.expect(';')
+        return result
+
+    def if_statement(self):
+        """Parse an if statement."""
+        position = self.lines[self.pos]
+        self.pos += 1
+        self.expect('(')
+        test = self.expression()
+        self.expect(')')
+        then_block = self.block()
+        if self.tokens[self.pos] == 'else':
+            else_position = self.lines[self.pos]
+            self.pos += 1
+            if self.tokens[self.pos] == 'if':
+                else_block = ucstmt.BlockNode(else_position,
+                                              [self.if_statement()])
+            else:
+                else_block = self.block()
+        else:
+            # the PLY parser reduces a missing else when it sees the
+            # next token, so the empty block has that token's line
+            else_block = ucstmt.BlockNode(self.lines[self.pos], [])
+        return ucstmt.IfNode(position, test, then_block, else_block)
+
+    def for_statement(self, node_class, position):
+        """Parse the rest of a for statement, after for."""
+        self.expect('(')
+        init = self.optional_expression(';')
+        self.expect(';')
+        test = self.optional_expression(';')
+        self.expect(';')
+        update = self.optional_expression(')')
+        self.expect(')')
+        return node_class(position, init, test, update, self.block())
+
+    def optional_expression(self, end):
+        """Parse an expression, or None if the next token is end."""
+        if self.tokens[self.pos] == end:
+            return None
+        return self.expression()
+
+    def arguments(self, end):
+        """Parse a possibly empty list of arguments, up to end."""
+        args = []
+        if self.tokens[self.pos] != end:
+            args.append(self.expression())
+            while self.tokens[self.pos] == ',':
+                self.pos += 1
+                args.append(self.expression())
+        self.expect(end)
+        return args
+
+    def expression(self):
+        """Parse an expression.
+
+        Binary operators are parsed with a stack of pending operators
+        and their left operands, reducing them in the same order as
+        the PLY parser.
+        """
+        tokens = self.tokens
+        pending = []
+        right = self.operand()
+        while True:
+            op = BINARY_OPS.get(tokens[self.pos])
+            level = 0 if op is None else op[1]
+            while pending:
+                top = pending[-1][1]
+                if top[1] < level or top[1] == level and top[2]:
+                    break
+                if top[1] == level and level in NONASSOC_LEVELS:
+                    raise GiveUp
+                left, (node_class, _, _), position = pending.pop()
+                right = node_class(position, left, right)
+            if op is None:
+                return right
+            pending.append((right, op, self.lines[self.pos]))
+            self.pos += 1
+            right = self.operand()
+
+    def operand(self):
+        """Parse an expression with prefix, field, and index operators.
+
+        The prefix operators apply to the result of the field and
+        index operators that follow.
+        """
+        tokens = self.tokens
+        lines = self.lines
+        pos = self.pos
+        prefixes = []
+        node_class = UNARY_OPS.get(tokens[pos])
+        while node_class is not None:
+            prefixes.append((node_class, lines[pos]))
+            pos += 1
+            node_class = UNARY_OPS.get(tokens[pos])
+        token = tokens[pos]
+        first = token[:1]
+        # names and numbers are the most common operands, so they are
+        # handled here without calling primary()
+        if (first in NAME_START and token not in RESERVED
+                and tokens[pos + 1] != '('):
+            line = lines[pos]
+            left = ucexpr.NameExpressionNode(line,
+                                             ucbase.NameNode(line, token))
+            self.pos = pos + 1
+        elif first in DIGITS:
+            if '.' in token or 'e' in token:
+                left = ucexpr.FloatNode(lines[pos], token)
+            else:
+                left = ucexpr.IntegerNode(lines[pos], token)
+            self.pos = pos + 1
+        else:
+            self.pos = pos
+            left = self.primary()
+        left = self.postfix(left)
+        for node_class, position in reversed(prefixes):
+            left = node_class(position, left)
+        return left
+
+    def postfix(self, left):
+        """Parse the field and index operators applied to left."""
+        tokens = self.tokens
+        while True:
+            token = tokens[self.pos]
+            if token == '.':
+                position = self.lines[self.pos]
+                self.pos += 1
+                left = ucexpr.FieldAccessNode(position, left, self.name())
+            elif token == '[':
+                position = self.lines[self.pos]
+                self.pos += 1
+                index = self.expression()
+                if tokens[self.pos] == ',':
+                    self.pos += 1
+                    second = self.expression()
+                    self.expect(']')
+                    left = ucexpr.MatrixIndexNode(position, left, index,
+                                                  second)
+                else:
+                    self.expect(']')
+                    left = ucexpr.ArrayIndexNode(position, left, index)
+            else:
+                return left
+
+    def primary(self):
+        """Parse a literal, name, call, new, or parenthesized expression."""
+        pos = self.pos
+        token = self.tokens[pos]
+        line = self.lines[pos]
+        first = token[:1]
+        self.pos = pos + 1
+        if first in NAME_START:
+            if token in RESERVED:
+                return self.keyword_expression(token, line)
+            name = ucbase.NameNode(line, token)
+            if self.tokens[pos + 1] != '(':
+                return ucexpr.NameExpressionNode(line, name)
+            self.pos += 1
+            return ucexpr.CallNode(self.lines[pos + 1], name,
+                                   self.arguments(')'))
+        if first in NUMBER_START and token != '.':
+            return (ucexpr.FloatNode if '.' in token or 'e' in token
+                    else ucexpr.IntegerNode)(line, token)
+        if first == '"' and len(token) > 1:
+            return ucexpr.StringNode(line, token)
+        if token != '(':
+            raise GiveUp
+        expr = self.expression()
+        self.expect(')')
+        return expr
+
+    def keyword_expression(self, token, position):
+        """Parse a boolean or null literal or a new expression.
+
+        token is the reserved word that starts the expression, which
+        has been skipped.
+        """
+        if token in ('true', 'false'):
+            return ucexpr.BooleanNode(position, token)
+        if token == 'null':
+            return ucexpr.NullNode(position)
+        if token != 'new':
+            raise GiveUp
+        return self.new_expression(position)
+
+    def new_expression(self, position):
+        """Parse the rest of a new expression, after new."""
+        type_position = self.lines[self.pos]
+        name = self.name()
+        token = self.tokens[self.pos]
+        if token == '(':
+            self.pos += 1
+            return ucexpr.NewNode(position, name, self.arguments(')'))
+        if token == '<':
+            map_type = self.map_type(name)
+            if self.tokens[self.pos] == '(':
+                self.pos += 1
+                self.expect(')')
+                return ucexpr.NewMapNode(position, map_type)
+            elem_type = self.type_suffixes(map_type, type_position)
+        else:
+            elem_type = self.type_suffixes(
+                ucbase.TypeNameNode(type_position, name), type_position
+            )
+        token = self.tokens[self.pos]
+        if token == '{':
+            self.pos += 1
+            return ucexpr.NewArrayNode(position, elem_type,
+                                       self.arguments('}'))
+        self.expect('[')
+        size = self.expression()
+        if self.tokens[self.pos] == ',':
+            self.pos += 1
+            second = self.expression()
+            self.expect(']')
+            return ucexpr.NewMatrixNode(position, elem_type, size, second)
+        self.expect(']')
+        return ucexpr.NewSizedArrayNode(position, elem_type, size)
@@ -21,6 +21,28 @@ def make_global_env():
     return ucbase.GlobalEnv()
 
 
+def phase_context(phase, global_env):
+    """Return a context for running the given frontend phase."""
+    ctx = uccontext.PhaseContext(phase, global_env)
+    if phase == 2:
+        # whether or not the current node is the node specifying the
+        # return type of a function
+        ctx['is_return'] = False
+    elif phase == 5:
+        # whether or not the current node is within a loop
+        ctx['in_loop'] = False
+        # whether the innermost loop, or any enclosing loop, is a
+        # parallel for
+        ctx['in_parallel_loop'] = False
+        ctx['in_parallel_body'] = False
+    elif phase == 6:
+        # used to look up local names
+        ctx['local_env'] = None
+        # used to check types of return expressions
+        ctx['rettype'] = None
+    return ctx
+
+
 ###################
 # Frontend Phases #
 ###################
@@ -31,8 +53,7 @@ def find_decls(tree, global_env):
     Adds the types and functions that are found to global_env. Reports
     an error if a type or function is multiply defined.
     """
-    ctx = uccontext.PhaseContext(1, global_env)
-    tree.find_decls(ctx)
+    tree.find_decls(phase_context(1, global_env))
 
 
 def resolve_types(tree, global_env):
@@ -41,11 +62,7 @@ def resolve_types(tree, global_env):
     Uses global_env to look up a type name. Reports an error if an
     unknown type is named.
     """
-    ctx = uccontext.PhaseContext(2, global_env)
-    # whether or not the current node is the node specifying the
-    # return type of a function
-    ctx['is_return'] = False
-    tree.resolve_types(ctx)
+    tree.resolve_types(phase_context(2, global_env))
 
 
 def resolve_calls(tree, global_env):
@@ -54,8 +71,7 @@ def resolve_calls(tree, global_env):
     Uses global_env to look up a function name. Reports an error if an
     unknown function is named.
     """
-    ctx = uccontext.PhaseContext(3, global_env)
-    tree.resolve_calls(ctx)
+    tree.resolve_calls(phase_context(3, global_env))
 
 
 def check_names(tree, global_env):
@@ -64,16 +80,12 @@ def check_names(tree, global_env):
     Checks the names introduced within a type or function to ensure
     they are unique in the scope of the type or function.
     """
-    ctx = uccontext.PhaseContext(4, global_env)
-    tree.check_names(ctx)
+    tree.check_names(phase_context(4, global_env))
 
 
 def basic_control(tree, global_env):
     """Check basic control flow within the given AST node."""
-    ctx = uccontext.PhaseContext(5, global_env)
-    # whether or not the current node is within a loop
-    ctx['in_loop'] = False
-    tree.basic_control(ctx)
+    tree.basic_control(phase_context(5, global_env))
 
 
 def type_check(tree, global_env):
@@ -83,13 +95,14 @@ def type_check(tree, global_env):
     context in which it is used. Checks that a valid main function
     exists.
     """
-    ctx = uccontext.PhaseContext(6, global_env)
-    # used to look up local names
-    ctx['local_env'] = None
-    # used to check types of return expressions
-    ctx['rettype'] = None
+    ctx = phase_context(6, global_env)
     tree.type_check(ctx)
-    # check for main
+    check_main(tree, ctx)
+
+
+def check_main(tree, ctx):
+    """Check that a valid main function exists."""
+    global_env = ctx.global_env
     func = global_env.lookup_function(ctx.phase, tree.position,
                                       'main', False)
     if func is None:
@@ -107,8 +120,88 @@ def type_check(tree, global_env):
 
 def advanced_control(tree, global_env):
     """Check advanced control flow within the given AST node."""
-    ctx = uccontext.PhaseContext(7, global_env)
-    tree.advanced_control(ctx)
+    tree.advanced_control(phase_context(7, global_env))
+
+
+##################
+# Fused Pipeline #
+##################
+
+# the phase methods of phases 3 through 7, by phase number
+PHASE_METHODS = {
+    3: 'resolve_calls',
+    4: 'check_names',
+    5: 'basic_control',
+    6: 'type_check',
+    7: 'advanced_control',
+}
+
+# groups of phases that are run together in a single walk of each
+# declaration. The phases in a group do not depend on each other's
+# results, but a group depends on the results of the groups before
+# it within the same declaration. Every group depends on phases 1
+# and 2 having been run on the whole program, since checking a
+# function needs the types of the structs and functions it uses.
+FUSED_PHASES = ((3, 4, 5), (6, 7))
+
+
+def phase_contexts(global_env, last_phase):
+    """Return contexts for phases 3 through last_phase, by number."""
+    return {phase: phase_context(phase, global_env)
+            for phase in PHASE_METHODS if phase <= last_phase}
+
+
+def phase_cutoff(last_phase):
+    """Return the last phase that is still worth running.
+
+    This is the first phase with held errors, since the errors of
+    later phases would never be reported, or last_phase if there are
+    none.
+    """
+    return min(ucerror.first_error_phase() or last_phase, last_phase)
+
+
+def check_decl(decl, contexts, last_phase):
+    """Run the groups in FUSED_PHASES on a single declaration.
+
+    contexts maps each phase to its context. Runs only the phases up
+    to the cutoff given by the errors held so far.
+    """
+    for group in FUSED_PHASES:
+        cutoff = phase_cutoff(last_phase)
+        if group[0] > cutoff:
+            break
+        ucbase.walk_phases(decl, [(PHASE_METHODS[phase], contexts[phase])
+                                  for phase in group if phase <= cutoff])
+
+
+def check_program(tree, contexts, last_phase):
+    """Run the checks of phases 3 through last_phase on the program.
+
+    Must be run after check_decl() has been run on every declaration.
+    """
+    if 6 <= phase_cutoff(last_phase):
+        previous = ucerror.set_phase(6)
+        check_main(tree, contexts[6])
+        ucerror.set_phase(previous)
+
+
+def check_decls(tree, global_env, last_phase):
+    """Run phases 3 through last_phase on each declaration in the AST.
+
+    Runs each group in FUSED_PHASES in one walk of a declaration,
+    rather than walking the whole tree once per phase. Errors are held
+    for each phase, to be reported with ucerror.flush_errors() as if
+    the phases had been run one after another. Once a phase has
+    reported errors, the phases after it are not run on the remaining
+    declarations, and a group is not run on a declaration if an
+    earlier group has reported errors anywhere.
+    """
+    contexts = phase_contexts(global_env, last_phase)
+    ucerror.buffer_errors()
+    for decl in tree.decls:
+        check_decl(decl, contexts, last_phase)
+    check_program(tree, contexts, last_phase)
 
 
 def write_types(tree, global_env, out):
@@ -23,6 +23,8 @@ class Function:
         self.name = name
         self.rettype = None
         self.param_types = []
+        # the positions of the arguments that the function modifies
+        self.writes = ()
 
     def __str__(self):
         """Return the name of this function."""
@@ -45,34 +47,135 @@ class Function:
         is the source position where this check occurs. Reports an
         error if the arguments are incompatible with this function.
         """
-        if len(args) != len(self.param_types):
+        self.check_arg_types(phase, position, args, self.param_types)
+
+    def check_arg_types(self, phase, position, args, param_types):
+        """Check if the arguments are compatible with the given types.
+
+        phase is the current compiler phase, position is the source
+        position where this check occurs. Reports an error if the
+        number of arguments differs from the number of parameter
+        types, or if an argument is incompatible with its parameter.
+        """
+        if len(args) != len(param_types):
             error(phase, position,
                   f"function {self.name}" +
-                  f"expected {len(self.param_types)} argument(s),"
+                  f"expected {len(param_types)} argument(s),"
                   + f"but got {len(args)}")
         else:
-            for arg, param in zip(args, self.param_types):
+            for arg, param in zip(args, param_types):
                 if not uctypes.is_compatible(arg.type, param):
                     error(phase, position,
                           f"type {arg.type} of "
                           + "argument is not compatible with parameter "
                           + f"of type {param}")
 
+    def return_type(self, _):
+        """Return the type of a call to this function.
+
+        The argument expressions of the call are passed in, and they
+        must already have their types computed.
+        """
+        return self.rettype
+
+    def written_args(self, args):
+        """Return the arguments of a call that this function may modify.
+
+        The objects that these arguments refer to may be modified in
+        place by the call.
+        """
+        return [args[i] for i in self.writes if i < len(args)]
+
 
 class PrimitiveFunction(Function):
     """A class that represents a primitive uC function."""
 
-    def __init__(self, name, rettype, param_types, type_env):
+    def __init__(self, name, rettype, param_types, type_env, writes=()):
         """Initialize this function with the given name.
 
         rettype is the name of the return type, param_types is a
         sequence of names of the parameter types, and type_env is the
-        dictionary in which to look up type names.
+        dictionary in which to look up type names. A name may end in
+        [] to denote an array type. writes holds the positions of the
+        arguments that the function modifies.
         """
         super().__init__(name)
-        self.rettype = type_env[rettype]
+        self.writes = writes
+        self.rettype = lookup_builtin_type(rettype, type_env)
         for param in param_types:
-            self.param_types.append(type_env[param])
+            self.param_types.append(lookup_builtin_type(param, type_env))
+
+
+def lookup_builtin_type(name, type_env):
+    """Look up the type of the given name in type_env.
+
+    A name that ends in [] denotes the array type of the type named by
+    the rest of it.
+    """
+    if name.endswith('[]'):
+        return lookup_builtin_type(name[:-2], type_env).array_type
+    return type_env[name]
+
+
+class GenericFunction(Function):
+    """A class that represents a built-in uC function over a container.
+
+    The parameter and return types of a generic function depend on the
+    type of its first argument, which must be an array or other
+    container. signature is a function that takes the container type
+    and returns a pair of the parameter types and the return type for
+    a call on that container, or None if the function cannot be
+    applied to it. A user-defined function of the same name shadows a
+    generic function.
+    """
+
+    def __init__(self, name, signature, type_env, writes=()):
+        """Initialize this function with the given name and signature.
+
+        type_env is the dictionary in which to look up the type that
+        is used for a call that cannot be typed. writes holds the
+        positions of the arguments that the function modifies.
+        """
+        super().__init__(name)
+        self.writes = writes
+        self.signature = signature
+        self.default_type = type_env['int']
+
+    def instantiate(self, args):
+        """Return the signature of a call with the given arguments.
+
+        The result is a pair of the parameter types and the return
+        type, or None if the function cannot be applied to the given
+        arguments.
+        """
+        if not args or not args[0].type:
+            return None
+        return self.signature(args[0].type)
+
+    def check_args(self, phase, position, args):
+        """Check if the arguments are compatible with this function.
+
+        The first argument determines the parameter types against
+        which the remaining arguments are checked. Reports an error if
+        the function cannot be applied to the first argument, or if
+        the arguments are otherwise incompatible with this function.
+        """
+        signature = self.instantiate(args)
+        if signature is None:
+            error(phase, position,
+                  f"function {self.name} cannot be applied to "
+                  + (f"type {args[0].type}" if args else "no arguments"))
+        else:
+            self.check_arg_types(phase, position, args, signature[0])
+
+    def return_type(self, args):
+        """Return the type of a call to this function.
+
+        The argument expressions of the call are passed in, and they
+        must already have their types computed.
+        """
+        signature = self.instantiate(args)
+        return signature[1] if signature else self.default_type
 
 
 class UserFunction(Function):
@@ -127,6 +230,104 @@ def add_conversions(func_env, type_env):
     func_env[func.name] = func
 
 
+def add_array_functions(func_env, type_env):
+    """Create the generic uC functions that operate on arrays.
+
+    func_env is the dictionary in which to insert the functions.
+    type_env is the dictionary to use to look up type names.
+    """
+    def sort_signature(array_type):
+        if (isinstance(array_type, uctypes.ArrayType) and
+                uctypes.is_ordered_type(array_type.elem_type)):
+            return (array_type,), type_env['void']
+        return None
+
+    def search_signature(array_type):
+        if (isinstance(array_type, uctypes.ArrayType) and
+                uctypes.is_ordered_type(array_type.elem_type)):
+            return (array_type, array_type.elem_type), type_env['int']
+        return None
+
+    def reserve_signature(array_type):
+        if isinstance(array_type, uctypes.ArrayType):
+            return (array_type, type_env['int']), type_env['void']
+        return None
+
+    func_env['sort'] = GenericFunction('sort', sort_signature, type_env,
+                                       writes=(0,))
+    func_env['binary_search'] = GenericFunction('binary_search',
+                                                search_signature,
+                                                type_env)
+    func_env['reserve'] = GenericFunction('reserve', reserve_signature,
+                                          type_env, writes=(0,))
+
+
+def add_numeric_functions(func_env, type_env):
+    """Create the generic uC functions that compute over numeric arrays.
+
+    func_env is the dictionary in which to insert the functions.
+    type_env is the dictionary to use to look up type names.
+    """
+    def reduce_signature(array_type):
+        if (isinstance(array_type, uctypes.ArrayType) and
+                uctypes.is_numeric_type(array_type.elem_type)):
+            return (array_type,), array_type.elem_type
+        return None
+
+    def dot_signature(array_type):
+        if (isinstance(array_type, uctypes.ArrayType) and
+                uctypes.is_numeric_type(array_type.elem_type)):
+            return (array_type, array_type), array_type.elem_type
+        return None
+
+    def fixed_signature(param_types, rettype):
+        # the element-wise functions work only on float arrays, but
+        # are generic so that user functions may shadow them
+        params = tuple(lookup_builtin_type(param, type_env)
+                       for param in param_types)
+        return lambda _: (params, lookup_builtin_type(rettype, type_env))
+
+    for name in ('sum', 'min', 'max'):
+        func_env[name] = GenericFunction(name, reduce_signature, type_env)
+    func_env['dot'] = GenericFunction('dot', dot_signature, type_env)
+    for name, param_types, rettype, writes in (
+            ('sqrt_all', ('float[]',), 'float[]', ()),
+            ('axpy', ('float', 'float[]', 'float[]'), 'void', (2,)),
+            ('add_all', ('float[]', 'float[]'), 'float[]', ()),
+            ('mul_all', ('float[]', 'float[]'), 'float[]', ())):
+        func_env[name] = GenericFunction(name,
+                                         fixed_signature(param_types,
+                                                         rettype),
+                                         type_env, writes)
+
+
+def add_map_functions(func_env, type_env):
+    """Create the generic uC functions that operate on maps.
+
+    func_env is the dictionary in which to insert the functions.
+    type_env is the dictionary to use to look up type names.
+    """
+    def map_signature(extra_params, rettype):
+        def signature(map_type):
+            if not isinstance(map_type, uctypes.MapType):
+                return None
+            params = (map_type, map_type.key_type)
+            if extra_params:
+                params += (map_type.value_type,)
+            return params, rettype or map_type.value_type
+        return signature
+
+    for name, extra_params, rettype, writes in (
+            ('get', False, None, ()),
+            ('put', True, type_env['void'], (0,)),
+            ('contains', False, type_env['boolean'], ()),
+            ('remove', False, type_env['void'], (0,))):
+        func_env[name] = GenericFunction(name,
+                                         map_signature(extra_params,
+                                                       rettype),
+                                         type_env, writes)
+
+
 def add_builtin_functions(func_env, type_env):
     """Create all the primitive uC functions.
 
@@ -135,6 +336,9 @@ def add_builtin_functions(func_env, type_env):
     names.
     """
     add_conversions(func_env, type_env)
+    add_array_functions(func_env, type_env)
+    add_numeric_functions(func_env, type_env)
+    add_map_functions(func_env, type_env)
     # string functions
     func_env['length'] = PrimitiveFunction('length', 'int',
                                            ('string',), type_env)
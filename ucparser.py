@@ -8,6 +8,7 @@ Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
 """
 
 import importlib
+import ucfastparse
 from ucbase import *
 from ucstmt import *
 from ucexpr import *
@@ -186,6 +187,7 @@ precedence = (
 def p_program(p):
     """Program : Declarations"""
     p[0] = ProgramNode(p.lineno(1), p[1])
+    p[0].parallel = has_parallel_for
 
 
 def p_declarations(p):
@@ -211,6 +213,18 @@ def p_structdecl(p):
     p[0] = StructDeclNode(p.lineno(1), p[2], p[4])
 
 
+# value is not a reserved word, so any other name preceding struct is
+# reported as a syntax error
+def p_valuestructdecl(p):
+    """StructDecl : Name STRUCT Name LPAREN VarDeclsOpt RPAREN SEMI"""
+    global num_errors
+    if p[1].raw != 'value':
+        print("Syntax error at line {0}: '{1}'".format(p.lineno(1),
+                                                       p[1].raw))
+        num_errors += 1
+    p[0] = StructDeclNode(p.lineno(2), p[3], p[5], True)
+
+
 def p_vardeclsopt(p):
     """VarDeclsOpt : VarDecls
                    | empty
@@ -244,6 +258,28 @@ def p_type(p):
         p[0] = ArrayTypeNameNode(p.lineno(1), p[1])
 
 
+def p_type_matrix(p):
+    """Type : Type LBRACKET COMMA RBRACKET"""
+    p[0] = MatrixTypeNameNode(p.lineno(1), p[1])
+
+
+def p_type_map(p):
+    """Type : MapType"""
+    p[0] = p[1]
+
+
+# map is not a reserved word, so any other name given type arguments
+# is reported as a syntax error
+def p_maptype(p):
+    """MapType : Name LT Type COMMA Type GT"""
+    global num_errors
+    if p[1].raw != 'map':
+        print("Syntax error at line {0}: '{1}'".format(p.lineno(1),
+                                                       p[1].raw))
+        num_errors += 1
+    p[0] = MapTypeNameNode(p.lineno(1), p[3], p[5])
+
+
 def p_name(p):
     """Name : IDENT"""
     p[0] = NameNode(p.lineno(1), p[1])
@@ -341,6 +377,24 @@ def p_forstatement(p):
     p[0] = ForNode(p.lineno(1), p[3], p[5], p[7], p[9])
 
 
+# whether the program being parsed contains a parallel for
+has_parallel_for = False
+
+
+# parallel is not a reserved word, so any other name preceding for is
+# reported as a syntax error
+def p_parallelforstatement(p):
+    """ForStatement : Name FOR LPAREN ExpressionOpt SEMI ExpressionOpt \
+                          SEMI ExpressionOpt RPAREN Block"""
+    global num_errors, has_parallel_for
+    if p[1].raw != 'parallel':
+        print("Syntax error at line {0}: '{1}'".format(p.lineno(1),
+                                                       p[1].raw))
+        num_errors += 1
+    has_parallel_for = True
+    p[0] = ParallelForNode(p.lineno(2), p[4], p[6], p[8], p[10])
+
+
 def p_breakstatement(p):
     """BreakStatement : BREAK SEMI"""
     p[0] = BreakNode(p.lineno(1))
@@ -467,11 +521,27 @@ def p_newexpression(p):
     p[0] = NewNode(p.lineno(1), p[2], p[4])
 
 
+def p_newmapexpression(p):
+    """NewExpression : NEW MapType LPAREN RPAREN"""
+    p[0] = NewMapNode(p.lineno(1), p[2])
+
+
 def p_arrayexpression(p):
     """ArrayExpression : NEW Type LBRACE ArgumentsOpt RBRACE"""
     p[0] = NewArrayNode(p.lineno(1), p[2], p[4])
 
 
+def p_sizedarrayexpression(p):
+    """ArrayExpression : NEW Type LBRACKET Expression RBRACKET"""
+    p[0] = NewSizedArrayNode(p.lineno(1), p[2], p[4])
+
+
+def p_matrixexpression(p):
+    """ArrayExpression : NEW Type LBRACKET Expression COMMA Expression \
+                         RBRACKET"""
+    p[0] = NewMatrixNode(p.lineno(1), p[2], p[4], p[6])
+
+
 def p_fieldaccessexpression(p):
     """FieldAccessExpression : Expression PERIOD Name"""
     p[0] = FieldAccessNode(p.lineno(2), p[1], p[3])
@@ -482,6 +552,12 @@ def p_arrayindexexpression(p):
     p[0] = ArrayIndexNode(p.lineno(2), p[1], p[3])
 
 
+def p_matrixindexexpression(p):
+    """ArrayIndexExpression : Expression LBRACKET Expression COMMA \
+                              Expression RBRACKET"""
+    p[0] = MatrixIndexNode(p.lineno(2), p[1], p[3], p[5])
+
+
 unary_ops = {
     '+': PrefixPlusNode,
     '-': PrefixMinusNode,
@@ -567,9 +643,23 @@ def error_count():
 
 
 def parse(filename):
-    """Read a uC source file, parse it, and return an AST."""
+    """Read a uC source file, parse it, and return an AST.
+
+    The lexer and parser are reused across calls, so the line number
+    and error count start over for each file. The code is first parsed
+    by ucfastparse.py, which produces the same AST much faster; if it
+    cannot, the code is parsed here, which also reports any errors.
+    """
+    global num_errors, has_parallel_for
+    num_errors = 0
+    has_parallel_for = False
+    lexer.lineno = 1
     with open(filename) as f:
-        return parser.parse(f.read(), tracking=True)
+        text = f.read()
+    tree = ucfastparse.parse(text)
+    if tree is not None:
+        return tree
+    return parser.parse(text, lexer=lexer, tracking=True)
 
 
 if __name__ == '__main__':
@@ -0,0 +1,237 @@
+"""
+ucserver.py.
+
+This file implements the uC compile server, which runs the compiler
+on behalf of ucclient.py. The server imports the compiler and loads
+the parser tables once, then warms up the compiler's caches by
+compiling a small program. For each request, it forks a process that
+runs ucc.py's command-line interface in the client's working
+directory, so that each compile starts from the warm state and the
+options of one request do not carry over to the next. Output and the
+exit status are sent back to the client over a Unix socket.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import argparse
+import contextlib
+import io
+import os
+import signal
+import socket
+import stat
+import sys
+import tempfile
+import traceback
+
+import ucc
+import uccache
+import ucclient
+
+# a program that uses most kinds of declarations, statements, and
+# expressions, compiled when the server starts
+WARM_UP_SOURCE = '''
+struct point(int x, float y, string name, point next);
+value struct pair(int first, int second);
+
+int sum(int[] values)(int total, int i) {
+  total = 0;
+  for (i = 0; i < values.length; ++i) {
+    total = total + values[i];
+  }
+  return total;
+}
+
+void main(string[] args)(point p, pair q, int[] values, int i) {
+  p = new point(1, 2.5, "warm", null);
+  q = new pair(3, 4);
+  values = new int{1, 2, 3};
+  values << 4;
+  i = 0;
+  while (i < 3 && p != null) {
+    if (!(p.x > 2) || q.first == 3) {
+      p.x = p.x * 2 - 1;
+    } else {
+      break;
+    }
+    ++i;
+  }
+  println(p.name + sum(values) + int_to_string(q.second) + p.y);
+  parallel for (i = 0; i < values.length; ++i) {
+    values[i] = -values[i] / 2 % 3;
+  }
+}
+'''
+
+# the number of connections that may wait to be accepted
+BACKLOG = 16
+
+
+class _FrameWriter(io.TextIOBase):
+    """A stream that sends what is written to it as frames."""
+
+    def __init__(self, conn, kind):
+        """Initialize this stream to send frames of the given kind."""
+        super().__init__()
+        self.conn = conn
+        self.kind = kind
+        self.pending = []
+
+    def write(self, text):
+        """Buffer the given text, to be sent by flush()."""
+        self.pending.append(text)
+        return len(text)
+
+    def flush(self):
+        """Send the buffered text as a frame."""
+        if self.pending:
+            data = ''.join(self.pending).encode()
+            self.pending = []
+            ucclient.send_frame(self.conn, self.kind, data)
+
+
+def warm_up():
+    """Compile a small program to fill the compiler's caches.
+
+    The program is compiled in a temporary directory with its output
+    discarded. This also computes the compiler version used by the
+    cache.
+    """
+    uccache.compiler_version()
+    with tempfile.TemporaryDirectory() as directory:
+        filename = os.path.join(directory, 'warm_up.uc')
+        with open(filename, 'w') as source:
+            source.write(WARM_UP_SOURCE)
+        with contextlib.redirect_stdout(io.StringIO()):
+            ucc.uc_compile(filename, False, False, False, 0, 0)
+
+
+def handle(conn):
+    """Run a compile request received on conn, returning its status.
+
+    Runs in a process forked for the request. Standard out and
+    standard error are sent to the client, followed by the exit
+    status that ucc.py would have exited with.
+    """
+    frame = ucclient.receive_frame(conn)
+    if frame is None or frame[0] != ucclient.REQUEST:
+        return 1
+    cwd, *args = [os.fsdecode(arg) for arg in frame[1].split(b'\0')]
+    out = _FrameWriter(conn, ucclient.STDOUT)
+    err = _FrameWriter(conn, ucclient.STDERR)
+    sys.stdout, sys.stderr = out, err
+    try:
+        os.chdir(cwd)
+        sys.argv = ['ucc.py'] + args
+        ucc.main()
+        status = 0
+    except SystemExit as exc:
+        if exc.code is None or isinstance(exc.code, int):
+            status = exc.code or 0
+        else:
+            print(exc.code, file=sys.stderr)
+            status = 1
+    except Exception:  # pylint: disable=broad-except
+        traceback.print_exc()
+        status = 1
+    out.flush()
+    err.flush()
+    ucclient.send_frame(conn, ucclient.EXIT, str(status).encode())
+    return status
+
+
+def _reap(*_):
+    """Collect the exit status of finished request processes."""
+    with contextlib.suppress(ChildProcessError):
+        while os.waitpid(-1, os.WNOHANG)[0]:
+            pass
+
+
+def make_private_dir(directory):
+    """Create the given directory private to this user, if it is not.
+
+    Exits if the directory exists but is not private to this user,
+    since another user could then replace the socket in it.
+    """
+    with contextlib.suppress(FileExistsError):
+        os.mkdir(directory, 0o700)
+    info = os.lstat(directory)
+    if (not stat.S_ISDIR(info.st_mode) or info.st_uid != os.getuid()
+            or info.st_mode & 0o077):
+        sys.exit('ucserver.py: {0} must be a directory that only this '
+                 'user can access'.format(directory))
+
+
+def serve(path):
+    """Serve compile requests on a Unix socket at the given path.
+
+    Fails if another server is already listening on the path. A socket
+    file left behind by a server that is no longer running is
+    replaced. The socket in the default directory is created private
+    to this user, and connections from other users are refused.
+    """
+    directory = os.path.dirname(os.path.abspath(path))
+    if directory == os.path.abspath(ucclient.socket_dir()):
+        make_private_dir(directory)
+    if os.path.exists(path):
+        with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as probe:
+            if probe.connect_ex(path) == 0:
+                sys.exit('ucserver.py: a server is already listening on '
+                         + path)
+        os.unlink(path)
+    warm_up()
+    # remove the socket file when terminated
+    signal.signal(signal.SIGTERM, lambda signum, frame: sys.exit(0))
+    # collect finished request processes even while idle
+    signal.signal(signal.SIGCHLD, _reap)
+    with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as server:
+        # only this user may connect to the socket
+        umask = os.umask(0o177)
+        try:
+            server.bind(path)
+        finally:
+            os.umask(umask)
+        try:
+            server.listen(BACKLOG)
+            print('Listening on {0}.'.format(path), flush=True)
+            while True:
+                conn, _ = server.accept()
+                if not ucclient.same_user(conn):
+                    conn.close()
+                    continue
+                if os.fork() == 0:
+                    # the request process must never return to this
+                    # loop, even if the request is malformed
+                    status = 1
+                    try:
+                        signal.signal(signal.SIGTERM, signal.SIG_DFL)
+                        # worker processes of the request reap their own
+                        signal.signal(signal.SIGCHLD, signal.SIG_DFL)
+                        server.close()
+                        with conn:
+                            status = handle(conn)
+                    finally:
+                        os._exit(status)
+                conn.close()
+        finally:
+            os.unlink(path)
+
+
+def main():
+    """Command-line interface."""
+    aparser = argparse.ArgumentParser(description='Serve uC compile '
+                                      'requests from ucclient.py.')
+    aparser.add_argument('--socket', default=ucclient.default_socket(),
+                         help='path of the Unix socket to listen on '
+                         '(default: $UCC_SOCKET, or ucc.sock in '
+                         '$XDG_RUNTIME_DIR or in a per-user directory '
+                         'in the temporary directory)')
+    args = aparser.parse_args()
+    try:
+        serve(args.socket)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
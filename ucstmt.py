@@ -12,7 +12,9 @@ from typing import List, Optional
 from ucbase import ASTNode
 from ucerror import error
 from ucexpr import ExpressionNode
-# import uctypes
+import ucexpr
+import ucfunctions
+import uctypes
 
 
 @dataclass
@@ -70,8 +72,7 @@ class IfNode(StatementNode):
         ctx.print("if (", end="")
         self.test.gen_function_defs(ctx)
         ctx.print(") {")
-        new_ctx = ctx.clone()
-        new_ctx.indent += "  "
+        new_ctx = ctx.indented()
         self.then_block.gen_function_defs(new_ctx)
         ctx.print("}", indent=True, end="")
         ctx.print(" else {")
@@ -94,6 +95,7 @@ class WhileNode(StatementNode):
         """Check basic control flow within this AST node."""
         new_ctx = ctx.clone()
         new_ctx['in_loop'] = True
+        new_ctx['in_parallel_loop'] = False
         super().basic_control(new_ctx)
 
     def type_check(self, ctx):
@@ -114,8 +116,9 @@ class WhileNode(StatementNode):
         ctx.print("while (", end="")
         self.test.gen_function_defs(ctx)
         ctx.print(") {")
-        new_ctx = ctx.clone()
-        new_ctx.indent += "  "
+        new_ctx = ctx.indented()
+        new_ctx['in_parallel_loop'] = False
+        gen_loop_profile(self, new_ctx)
         self.body.gen_function_defs(new_ctx)
         ctx.print("}", indent=True)
 
@@ -140,6 +143,7 @@ class ForNode(StatementNode):
         """Check basic control flow within this AST node."""
         new_ctx = ctx.clone()
         new_ctx['in_loop'] = True
+        new_ctx['in_parallel_loop'] = False
         super().basic_control(new_ctx)
 
     def type_check(self, ctx):
@@ -164,12 +168,401 @@ class ForNode(StatementNode):
         ctx.print("; ", end="")
         self.update.gen_function_defs(ctx)
         ctx.print(") {")
-        new_ctx = ctx.clone()
-        new_ctx.indent += "  "
+        new_ctx = ctx.indented()
+        new_ctx['in_parallel_loop'] = False
+        gen_loop_profile(self, new_ctx)
         self.body.gen_function_defs(new_ctx)
         ctx.print("}", indent=True)
 
 
+@dataclass
+class ParallelForNode(ForNode):
+    """An AST node representing a parallel for statement.
+
+    The loop must have the form for (i = a; i < b; ++i), where < may
+    be <= and ++i may be i = i + 1, i and b are of type int, and its
+    iterations may run concurrently. The body may not break, return,
+    or write the loop variable. Local variables that the body
+    definitely assigns, on every path, before reading them are private
+    to each iteration, and the body may not write any other local
+    variable. Nor may it write through a shared reference, except to
+    an element of an array or matrix indexed by the loop variable. A
+    shared reference may not be passed to a built-in function that
+    modifies its argument, such as put() or sort(), nor to a user
+    function that may modify an object, as determined by
+    modifies_objects().
+    """
+
+    def loop_var(self):
+        """Return the name of the loop variable.
+
+        Returns None if this loop is not of the required form.
+        """
+        init, test, update = self.init, self.test, self.update
+        if not (isinstance(init, ucexpr.AssignNode) and
+                isinstance(init.lhs, ucexpr.NameExpressionNode)):
+            return None
+        name = init.lhs.name.raw
+        if not (isinstance(test, (ucexpr.LessNode, ucexpr.LessEqualNode))
+                and is_name(test.lhs, name)):
+            return None
+        if isinstance(update, ucexpr.PrefixIncrNode):
+            return name if is_name(update.expr, name) else None
+        if (isinstance(update, ucexpr.AssignNode) and
+                is_name(update.lhs, name) and
+                isinstance(update.rhs, ucexpr.PlusNode) and
+                is_name(update.rhs.lhs, name) and
+                isinstance(update.rhs.rhs, ucexpr.IntegerNode) and
+                update.rhs.rhs.text == '1'):
+            return name
+        return None
+
+    def body_accesses(self):
+        """Return the variables that the body writes and may read first.
+
+        Returns a list of the variables written by the body, in the
+        order of their first write, and the set of variables that may
+        be read or updated before they are definitely assigned, as
+        computed by flow_accesses().
+        """
+        exposed, written = set(), []
+        flow_accesses(self.body, set(), exposed, written)
+        return written, exposed
+
+    def private_vars(self):
+        """Return the names of the variables private to an iteration."""
+        written, exposed = self.body_accesses()
+        return [name for name in written
+                if name not in exposed and name != self.loop_var()]
+
+    def basic_control(self, ctx):
+        """Check basic control flow within this AST node."""
+        if self.loop_var() is None:
+            error(5, self.position,
+                  "parallel for must have the form "
+                  + "for (i = a; i < b; ++i)")
+        new_ctx = ctx.clone()
+        new_ctx['in_loop'] = True
+        new_ctx['in_parallel_loop'] = True
+        new_ctx['in_parallel_body'] = True
+        ASTNode.basic_control(self, new_ctx)
+
+    def type_check(self, ctx):
+        """Compute the type of each expression.
+
+        Uses ctx['local_env'] to compute the type of a local name.
+        Checks that the type of an expression is compatible with the
+        context in which it is used.
+        """
+        super().type_check(ctx)
+        var = self.loop_var()
+        if var is None:
+            return
+        if self.init.lhs.type.name != 'int':
+            error(6, self.position,
+                  "parallel for variable must be of type int, "
+                  + f"but was given {self.init.lhs.type}")
+        if self.test.rhs.type.name != 'int':
+            error(6, self.position,
+                  "parallel for bound must be of type int, "
+                  + f"but was given {self.test.rhs.type}")
+        written, exposed = self.body_accesses()
+        for name in written:
+            if name == var or name in exposed:
+                error(6, self.position,
+                      "parallel for body cannot write shared variable "
+                      + name)
+        private = self.private_vars()
+        lvalues = []
+        written_lvalues(self.body, lvalues)
+        for node in lvalues:
+            if not partitioned(node, private, var):
+                error(6, node.position,
+                      "parallel for body cannot write through a shared "
+                      + "reference")
+        args = []
+        written_args(self.body, ctx.global_env, args)
+        for call, arg in args:
+            if not refers_to_private(arg, private, var):
+                error(6, call.position,
+                      "parallel for body cannot pass a shared reference "
+                      + f"to function {call.func}")
+
+    def gen_function_defs(self, ctx):
+        """Generate function defs."""
+        var = f"UC_VAR({self.loop_var()})"
+        ctx.print(f"{var} = uc_parallel_for(", end="")
+        self.init.rhs.gen_function_defs(ctx)
+        ctx.print(", ", end="")
+        if isinstance(self.test, ucexpr.LessEqualNode):
+            # the end is a long, so that it does not overflow
+            ctx.print("static_cast<UC_PRIMITIVE(long)>(", end="")
+            self.test.rhs.gen_function_defs(ctx)
+            ctx.print(") + 1", end="")
+        else:
+            self.test.rhs.gen_function_defs(ctx)
+        ctx.print(f", [&](UC_PRIMITIVE(int) {var}) {{")
+        new_ctx = ctx.indented()
+        new_ctx['in_parallel_loop'] = True
+        for name in self.private_vars():
+            new_ctx.print(f"decltype(UC_VAR({name})) UC_VAR({name}){{}};",
+                          indent=True)
+        gen_loop_profile(self, new_ctx)
+        self.body.gen_function_defs(new_ctx)
+        ctx.print("});", indent=True)
+
+
+def gen_loop_profile(node, ctx):
+    """Generate code to count an iteration of the given loop.
+
+    Generates nothing unless loops are being profiled.
+    """
+    if 'time' in ctx['profile']:
+        ctx.print(f'UC_PROFILE_LOOP("{ctx["function_name"]}", '
+                  + f'{node.position});', indent=True)
+
+
+def is_name(node, name):
+    """Return whether the given node is a name expression for name."""
+    return (isinstance(node, ucexpr.NameExpressionNode) and
+            node.name.raw == name)
+
+
+def assigned_var(node):
+    """Return the local variable modified by assigning to node.
+
+    Assigning to a name expression or to a field of a local value
+    struct modifies a local variable. Returns None for any other
+    l-value.
+    """
+    while (isinstance(node, ucexpr.FieldAccessNode) and
+           isinstance(node.receiver.type, uctypes.ValueType)):
+        node = node.receiver
+    if isinstance(node, ucexpr.NameExpressionNode):
+        return node.name.raw
+    return None
+
+
+def variable_accesses(item, accesses):
+    """Append the accesses to local variables in an AST item to accesses.
+
+    Each access is a pair of a variable name and a kind, which is
+    'write' for an assignment to the whole variable, 'update' for any
+    other modification of the variable, and 'read' otherwise. Accesses
+    are appended in evaluation order. Types of expressions are used if
+    they have been computed.
+    """
+    if isinstance(item, list):
+        for child in item:
+            variable_accesses(child, accesses)
+    elif isinstance(item, (ucexpr.LogicalAndNode, ucexpr.LogicalOrNode)):
+        variable_accesses(item.lhs, accesses)
+        # the rhs may not be evaluated, so it does not assign anything
+        rhs = []
+        variable_accesses(item.rhs, rhs)
+        accesses.extend((name, 'update' if kind == 'write' else kind)
+                        for name, kind in rhs)
+    elif isinstance(item, ucexpr.NameExpressionNode):
+        accesses.append((item.name.raw, 'read'))
+    elif (isinstance(item, ucexpr.AssignNode) and
+          assigned_var(item.lhs) is not None):
+        variable_accesses(item.rhs, accesses)
+        variable_accesses(item.lhs, accesses)
+        if isinstance(item.lhs, ucexpr.NameExpressionNode):
+            accesses[-1] = (assigned_var(item.lhs), 'write')
+        else:
+            accesses.append((assigned_var(item.lhs), 'update'))
+    elif (isinstance(item, ucexpr.PrefixIncrDecrNode) and
+          assigned_var(item.expr) is not None):
+        variable_accesses(item.expr, accesses)
+        accesses.append((assigned_var(item.expr), 'update'))
+    elif isinstance(item, (ucexpr.PushNode, ucexpr.PopNode)):
+        # pushing or popping modifies the array in place, and popping
+        # assigns the target
+        variable_accesses(item.lhs, accesses)
+        if isinstance(item.lhs, ucexpr.NameExpressionNode):
+            accesses.append((item.lhs.name.raw, 'update'))
+        variable_accesses(item.rhs, accesses)
+        if (isinstance(item, ucexpr.PopNode) and
+                assigned_var(item.rhs) is not None):
+            accesses.append((assigned_var(item.rhs), 'update'))
+    elif isinstance(item, ASTNode):
+        variable_accesses(item.children, accesses)
+
+
+def flow_accesses(item, assigned, exposed, written):
+    """Find the local variables in an AST item that are read first.
+
+    assigned is the set of variables definitely assigned before the
+    item, and is updated to those definitely assigned after it. Each
+    variable that may be read or updated by the item before it is
+    definitely assigned is added to the set exposed, and each variable
+    that the item writes or updates is appended to the list written.
+    A loop body may run no times, and only one branch of an if runs.
+    """
+    if isinstance(item, list):
+        for child in item:
+            flow_accesses(child, assigned, exposed, written)
+    elif isinstance(item, IfNode):
+        flow_accesses(item.test, assigned, exposed, written)
+        then_assigned = set(assigned)
+        flow_accesses(item.then_block, then_assigned, exposed, written)
+        else_assigned = set(assigned)
+        flow_accesses(item.else_block, else_assigned, exposed, written)
+        assigned |= then_assigned & else_assigned
+    elif isinstance(item, WhileNode):
+        flow_accesses(item.test, assigned, exposed, written)
+        flow_accesses(item.body, set(assigned), exposed, written)
+    elif isinstance(item, ForNode):
+        flow_accesses([item.init, item.test], assigned, exposed, written)
+        body_assigned = set(assigned)
+        flow_accesses([item.body, item.update], body_assigned, exposed,
+                      written)
+    elif isinstance(item, ExpressionNode):
+        accesses = []
+        variable_accesses(item, accesses)
+        for name, kind in accesses:
+            if kind != 'read' and name not in written:
+                written.append(name)
+            if kind == 'write':
+                assigned.add(name)
+            elif name not in assigned:
+                exposed.add(name)
+    elif isinstance(item, ASTNode):
+        flow_accesses(item.children, assigned, exposed, written)
+
+
+def written_lvalues(item, lvalues):
+    """Append the l-values that an AST item writes to lvalues.
+
+    Pushing onto or popping from an array writes the array.
+    """
+    if isinstance(item, list):
+        for child in item:
+            written_lvalues(child, lvalues)
+    elif isinstance(item, ASTNode):
+        if isinstance(item, ucexpr.AssignNode):
+            lvalues.append(item.lhs)
+        elif isinstance(item, ucexpr.PrefixIncrDecrNode):
+            lvalues.append(item.expr)
+        elif isinstance(item, ucexpr.PushNode):
+            lvalues.append(item.lhs)
+        elif isinstance(item, ucexpr.PopNode):
+            lvalues += [item.lhs, item.rhs]
+        written_lvalues(item.children, lvalues)
+
+
+def written_args(item, global_env, args):
+    """Append the arguments that calls in an AST item may modify to args.
+
+    Each is appended as a pair of the call and the argument. A user
+    function that may modify an object may modify any object passed to
+    it.
+    """
+    if isinstance(item, list):
+        for child in item:
+            written_args(child, global_env, args)
+    elif isinstance(item, ASTNode):
+        if isinstance(item, ucexpr.CallNode) and item.func:
+            if not isinstance(item.func, ucfunctions.UserFunction):
+                args += [(item, arg)
+                         for arg in item.func.written_args(item.args)]
+            elif modifies_objects(item.func, global_env):
+                args += [(item, arg) for arg in item.args
+                         if arg.type and uctypes.holds_references(arg.type)]
+        written_args(item.children, global_env, args)
+
+
+def modifies_objects(func, global_env):
+    """Return whether a user function may modify an object.
+
+    It may if its body, or that of any function that it calls
+    directly or indirectly, writes through a reference or calls a
+    built-in function that modifies its argument. The functions may
+    not have been type checked yet, so types are not used, and a
+    write to a field of a local value struct also counts.
+    """
+    seen = {func.name}
+    stack = [func]
+    while stack:
+        calls = []
+        if object_writes(stack.pop().decl.body, calls):
+            return True
+        for name in calls:
+            callee = global_env.lookup_function(6, None, name, strict=False)
+            if isinstance(callee, ucfunctions.UserFunction):
+                if name not in seen:
+                    seen.add(name)
+                    stack.append(callee)
+            elif callee is not None and callee.writes:
+                return True
+    return False
+
+
+def object_writes(item, calls):
+    """Return whether an AST item may write through a reference.
+
+    That is the case for an assignment to anything but a local
+    variable, and for pushing onto or popping from an array. The
+    names of the functions that the item calls are appended to calls.
+    """
+    if isinstance(item, list):
+        return any(object_writes(child, calls) for child in item)
+    if not isinstance(item, ASTNode):
+        return False
+    if isinstance(item, ucexpr.CallNode):
+        calls.append(item.name.raw)
+    if (isinstance(item, (ucexpr.PushNode, ucexpr.PopNode)) or
+            (isinstance(item, ucexpr.AssignNode) and
+             not isinstance(item.lhs, ucexpr.NameExpressionNode)) or
+            (isinstance(item, ucexpr.PrefixIncrDecrNode) and
+             not isinstance(item.expr, ucexpr.NameExpressionNode))):
+        return True
+    return object_writes(item.children, calls)
+
+
+def partitioned(node, private, var):
+    """Return whether iterations may write the l-value node at once.
+
+    A local variable, or a field of one that is a value struct, is
+    checked by flow_accesses() instead. Otherwise, the write must be
+    to an object that only this iteration refers to, given the names
+    of the private variables, or to an element indexed by the loop
+    variable var.
+    """
+    if isinstance(node, ucexpr.NameExpressionNode):
+        return True
+    if isinstance(node, ucexpr.FieldAccessNode):
+        if isinstance(node.receiver.type, uctypes.ValueType):
+            return partitioned(node.receiver, private, var)
+        return refers_to_private(node.receiver, private, var)
+    if isinstance(node, ucexpr.ArrayIndexNode):
+        return (is_name(node.index, var) or
+                refers_to_private(node.receiver, private, var))
+    if isinstance(node, ucexpr.MatrixIndexNode):
+        return (is_name(node.row, var) or is_name(node.col, var) or
+                refers_to_private(node.receiver, private, var))
+    return False
+
+
+def refers_to_private(node, private, var):
+    """Return whether the object that node refers to is not shared.
+
+    That is the case for a private variable, a field of a private
+    value struct, or an element indexed by the loop variable var.
+    """
+    if isinstance(node, ucexpr.NameExpressionNode):
+        return node.name.raw in private
+    if (isinstance(node, ucexpr.FieldAccessNode) and
+            isinstance(node.receiver.type, uctypes.ValueType)):
+        return refers_to_private(node.receiver, private, var)
+    if isinstance(node, ucexpr.ArrayIndexNode):
+        return is_name(node.index, var)
+    if isinstance(node, ucexpr.MatrixIndexNode):
+        return is_name(node.row, var) or is_name(node.col, var)
+    return False
+
+
 @dataclass
 class BreakNode(StatementNode):
     """An AST node representing a break statement."""
@@ -179,6 +572,9 @@ class BreakNode(StatementNode):
         """Check basic control flow within this AST node."""
         if not ctx['in_loop']:
             error(5, self.position, "break statement must occur within a loop")
+        elif ctx['in_parallel_loop']:
+            error(5, self.position,
+                  "break statement cannot exit a parallel for")
         super().basic_control(ctx)
 
     def gen_function_defs(self, ctx):
@@ -200,7 +596,11 @@ class ContinueNode(StatementNode):
 
     def gen_function_defs(self, ctx):
         """Generate function defs."""
-        ctx.print("continue;")
+        # the body of a parallel for is a function called per iteration
+        if ctx['in_parallel_loop']:
+            ctx.print("return;")
+        else:
+            ctx.print("continue;")
 
 
 @dataclass
@@ -213,6 +613,13 @@ class ReturnNode(StatementNode):
     expr: Optional[ExpressionNode]
 
     # add your code below
+    def basic_control(self, ctx):
+        """Check basic control flow within this AST node."""
+        if ctx['in_parallel_body']:
+            error(5, self.position,
+                  "return statement cannot occur within a parallel for")
+        super().basic_control(ctx)
+
     def type_check(self, ctx):
         """Compute the type of each expression.
 
@@ -17,6 +17,8 @@ class Type:
         """Initialize this type to have the given name."""
         self.name = name
         self._array_type = None  # cache for the array type
+        self._matrix_type = None  # cache for the matrix type
+        self._map_types = {}  # cache for map types keyed by this type
 
     def __str__(self):
         """Return the name of this type."""
@@ -29,6 +31,19 @@ class Type:
             self._array_type = ArrayType(self)
         return self._array_type
 
+    @property
+    def matrix_type(self):
+        """Return the matrix type with this type as its element type."""
+        if not self._matrix_type:
+            self._matrix_type = MatrixType(self)
+        return self._matrix_type
+
+    def map_type(self, value_type):
+        """Return the map type from this type to the given value type."""
+        if value_type not in self._map_types:
+            self._map_types[value_type] = MapType(self, value_type)
+        return self._map_types[value_type]
+
     def lookup_field(self, phase, position, name, global_env):
         """Lookup up a field in this type.
 
@@ -95,6 +110,77 @@ class ArrayType(Type):
         return global_env.lookup_type(6, position, 'int')
 
 
+class MatrixType(Type):
+    """A class representing a rectangular two-dimensional array type.
+
+    The instance attribute elem_type refers to the element type of the
+    matrix.
+    """
+
+    def __init__(self, elem_type):
+        """Initialize this type to have the given element type."""
+        super().__init__(elem_type.name + '[,]')
+        self.elem_type = elem_type
+
+    def mangle(self):
+        """Return the mangled name of this type.
+
+        The mangled name is the name that should be used in code
+        generation.
+        """
+        return 'UC_MATRIX({0})'.format(self.elem_type.mangle())
+
+    def lookup_field(self, phase, position, name, global_env):
+        """Lookup up a field in this type.
+
+        phase is the current compiler phase, position is the source
+        position from where this lookup occurs, name is the name of
+        the field, and global_env is the global environment. Reports
+        an error if the field is not found. Returns the type of the
+        field if it is found, int otherwise.
+        """
+        if name not in ('rows', 'cols'):
+            error(6, position, f"{name} is not a valid field of {self.name}")
+        return global_env.lookup_type(6, position, 'int')
+
+
+class MapType(Type):
+    """A class representing a map type.
+
+    The instance attributes key_type and value_type refer to the types
+    of the keys and values of the map.
+    """
+
+    def __init__(self, key_type, value_type):
+        """Initialize this type to have the given key and value types."""
+        super().__init__(f'map<{key_type.name}, {value_type.name}>')
+        self.key_type = key_type
+        self.value_type = value_type
+
+    def mangle(self):
+        """Return the mangled name of this type.
+
+        The mangled name is the name that should be used in code
+        generation.
+        """
+        return 'UC_MAP({0}, {1})'.format(self.key_type.mangle(),
+                                         self.value_type.mangle())
+
+    def lookup_field(self, phase, position, name, global_env):
+        """Lookup up a field in this type.
+
+        phase is the current compiler phase, position is the source
+        position from where this lookup occurs, name is the name of
+        the field, and global_env is the global environment. Reports
+        an error if the field is not found. Returns the type of the
+        field if it is found, int otherwise.
+        """
+        if name == 'length':
+            return global_env.lookup_type(6, position, 'int')
+        error(6, position, f"{name} is not a valid field of {self.name}")
+        return global_env.lookup_type(6, position, 'int')
+
+
 class PrimitiveType(Type):
     """A class representing a primitive type."""
 
@@ -168,6 +254,22 @@ class UserType(Type):
         return 'UC_REFERENCE({0})'.format(self.name)
 
 
+class ValueType(UserType):
+    """A class representing a user-defined value type.
+
+    Objects of a value type are stored inline and copied on
+    assignment, so they cannot be null and have no identity.
+    """
+
+    def mangle(self):
+        """Return the mangled name of this type.
+
+        The mangled name is the name that should be used in code
+        generation.
+        """
+        return 'UC_VALUE({0})'.format(self.name)
+
+
 def is_compatible(source, target):
     """Return whether the source type is assignable to the target type."""
     return ((source is target) or
@@ -175,7 +277,7 @@ def is_compatible(source, target):
              target.name in ('long', 'float')) or
             (source.name == 'long' and target.name == 'float') or
             (source.name == 'null' and
-             not isinstance(target, PrimitiveType)))
+             not isinstance(target, (PrimitiveType, ValueType))))
 
 
 def is_numeric_type(type_):
@@ -188,6 +290,33 @@ def is_integral_type(type_):
     return type_.name in ('int', 'long')
 
 
+def is_ordered_type(type_):
+    """Return whether the values of the given type are totally ordered.
+
+    Numeric and string values are ordered by value. Objects of a
+    user-defined type are ordered lexicographically by their fields,
+    provided that each field is of a numeric or string type.
+    """
+    if isinstance(type_, UserType):
+        return all(is_numeric_type(field.vartype.type) or
+                   field.vartype.type.name == 'string'
+                   for field in type_.fields)
+    return (isinstance(type_, PrimitiveType) and
+            (is_numeric_type(type_) or type_.name == 'string'))
+
+
+def holds_references(type_):
+    """Return whether a value of the given type may refer to objects.
+
+    A value struct is copied, so it refers to objects only through
+    its fields.
+    """
+    if isinstance(type_, ValueType):
+        return any(holds_references(field.vartype.type)
+                   for field in type_.fields)
+    return not isinstance(type_, PrimitiveType)
+
+
 def join_types(phase, position, type1, type2, global_env):
     """Compute the type of a binary operation from the operand types."""
     if type1 is type2:
@@ -0,0 +1,185 @@
+"""
+ucworkers.py.
+
+This file implements running the per-declaration work of the compiler
+in a pool of worker processes. Once the first two frontend phases
+have run, each declaration can be checked, and have its function
+definitions generated, independently of the others. The workers are
+forked from the compiler, so they share its AST and global
+environment without copying them, and their results are merged in
+source order. When several files are compiled at once, the files are
+divided among the workers instead.
+
+Project UID c49e54971d13f14fbc634d7a0fe4b38d421279e7
+"""
+
+import contextlib
+import io
+import multiprocessing
+
+import ucbackend
+import uccache
+import ucemit
+import ucerror
+import ucfrontend
+
+# number of chunks of declarations per worker, so that a worker that
+# draws large functions does not hold up the others
+CHUNKS_PER_JOB = 4
+
+
+def set_jobs(jobs):
+    """Use the given number of worker processes."""
+    set_jobs.jobs = jobs
+
+
+set_jobs.jobs = 1
+
+
+def enabled():
+    """Return whether per-declaration work runs in worker processes.
+
+    Requires more than one job and support for forking processes.
+    """
+    return (set_jobs.jobs > 1 and
+            'fork' in multiprocessing.get_all_start_methods())
+
+
+def map_decls(tree, task, *args):
+    """Run a task on the declarations in the AST in worker processes.
+
+    The declarations are divided into chunks of consecutive
+    declarations, and task(decls, *args) is called in a worker on
+    each chunk. Returns the results of the chunks in source order.
+    """
+    decls = tree.decls
+    if not decls:
+        return []
+    num_chunks = min(len(decls), set_jobs.jobs * CHUNKS_PER_JOB)
+    bounds = [len(decls) * i // num_chunks for i in range(num_chunks + 1)]
+    # inherited by the forked workers, rather than sent to them
+    map_decls.state = (decls, task, args)
+    try:
+        context = multiprocessing.get_context('fork')
+        with context.Pool(min(set_jobs.jobs, num_chunks)) as pool:
+            return pool.map(_run_chunk, zip(bounds, bounds[1:]),
+                            chunksize=1)
+    finally:
+        map_decls.state = None
+
+
+map_decls.state = None
+
+
+def _run_chunk(bounds):
+    """Run the task of map_decls() on the declarations in bounds."""
+    decls, task, args = map_decls.state
+    return task(decls[bounds[0]:bounds[1]], *args)
+
+
+def map_files(filenames, task, *args):
+    """Run a task on each of the given files in worker processes.
+
+    task(filename, *args) is called in a worker for each file, with
+    the output it prints captured. The output of each file is printed
+    in the order of filenames, once the file is done and those before
+    it have been printed. Returns the results of the files in order.
+    Each worker runs its declarations in a single process.
+    """
+    map_files.state = (task, args)
+    try:
+        context = multiprocessing.get_context('fork')
+        results = []
+        with context.Pool(min(set_jobs.jobs, len(filenames))) as pool:
+            for result, output in pool.imap(_run_file, filenames):
+                print(output, end='')
+                results.append(result)
+        return results
+    finally:
+        map_files.state = None
+
+
+map_files.state = None
+
+
+def _run_file(filename):
+    """Run the task of map_files() on a file, capturing its output."""
+    task, args = map_files.state
+    # a worker cannot start workers of its own
+    set_jobs(1)
+    output = io.StringIO()
+    with contextlib.redirect_stdout(output):
+        result = task(filename, *args)
+    return result, output.getvalue()
+
+
+def check_decls(tree, global_env, last_phase):
+    """Run phases 3 through last_phase on each declaration in the AST.
+
+    Does the same as ucfrontend.check_decls(), with the declarations
+    divided among worker processes. The errors held by each worker
+    are merged in source order. A worker stops running later phases
+    once its own declarations have errors, which is enough to keep
+    the reported errors the same. The results of the phases are not
+    returned to the AST in this process, which the backend does not
+    need.
+    """
+    results = map_decls(tree, _check_chunk, global_env, last_phase)
+    ucerror.buffer_errors()
+    for buffers in results:
+        ucerror.hold_errors(buffers)
+    ucfrontend.check_program(tree,
+                             ucfrontend.phase_contexts(global_env,
+                                                       last_phase),
+                             last_phase)
+
+
+def _check_chunk(decls, global_env, last_phase):
+    """Check a chunk of declarations, returning the errors held."""
+    contexts = ucfrontend.phase_contexts(global_env, last_phase)
+    ucerror.buffer_errors()
+    for decl in decls:
+        ucfrontend.check_decl(decl, contexts, last_phase)
+    return ucerror.held_errors()
+
+
+def gen_function_defs(tree, global_env, out):
+    """Generate full function definitions, writing them to out.
+
+    Does the same as ucbackend.gen_function_defs(), with the
+    declarations divided among worker processes, each of which
+    generates code into its own buffer.
+    """
+    ucbackend.section_context(4, global_env, out)
+    keys = (uccache.decl_keys(tree, ucbackend.enable_profiling.kinds)
+            if uccache.enabled() else None)
+    for code in map_decls(tree, _gen_chunk, global_env, keys):
+        out.write(code)
+
+
+def function_code(tree, global_env, keys):
+    """Return the function definitions generated for each declaration.
+
+    Does the same as ucbackend.function_code() on the declarations in
+    the AST, divided among worker processes.
+    """
+    return [code
+            for codes in map_decls(tree, ucbackend.function_code,
+                                   global_env, keys)
+            for code in codes]
+
+
+def _gen_chunk(decls, global_env, keys):
+    """Generate the code for a chunk of declarations, returning it.
+
+    Cached code is reused if keys, the cache keys of the
+    declarations, are given.
+    """
+    out = ucemit.Emitter()
+    ctx = ucbackend.function_defs_context(global_env, out)
+    if keys is not None:
+        uccache.gen_function_defs(decls, ctx, keys)
+    else:
+        for decl in decls:
+            decl.gen_function_defs(ctx)
+    return out.getvalue()